@@ -20,7 +20,9 @@ int main() try
 	std::puts("Press H J or K L! (casue 2 keys is the limit for some keyoards!)");
 	while(true)
 	{
-		next_event(); // update the key states
+		// update the key states, once, the events themselves are of no interest
+		pump();
+		while(next_event(no_pump));
 
 		if ((pressed(scancode::h) && pressed(scancode::j)) ||
 			(pressed(scancode::k) && pressed(scancode::l)) ||
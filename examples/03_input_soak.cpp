@@ -0,0 +1,255 @@
+#include <cstdio>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/event.h"
+#include "simple/interactive/queue.h"
+#include "simple/interactive/motion.h"
+#include "simple/interactive/mouse_state.h"
+#include "simple/support/misc.hpp"
+#include "common/sdl_input_grabber.h"
+
+#include "common/sdl_input_grabber.cpp"
+
+// Floods the SDL queue with synthesized mouse, touch and keyboard input from another thread,
+// while the main thread drains it the usual way, and reports every so often.
+// Runs on the dummy video driver unless told otherwise, so no display is needed.
+//
+// 03_input_soak [seconds=10] [mouse Hz=8000] [fingers=10] [touch Hz=240] [key Hz=50]
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+using clock_type = std::chrono::steady_clock;
+
+const auto start_time = clock_type::now();
+
+// microseconds since start, wrapping
+uint32_t now_stamp()
+{
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start_time);
+	return uint32_t(elapsed.count());
+}
+
+// The send times are kept on the side, indexed by a sequence number that travels in a field
+// nothing downstream keys on (window id, or pressure for touch, exact in a float up to 2^24),
+// the device ids stay fixed, as they would be with real hardware.
+// SDL_PushEvent overwrites the timestamp, so that's no good.
+constexpr uint32_t sequence_mask = (1u << 20) - 1;
+std::vector<std::atomic<uint32_t>> send_times(sequence_mask + 1);
+constexpr uint32_t mouse_device = 0;
+constexpr SDL_TouchID touch_device = 1;
+
+uint32_t stamp(uint32_t& sequence)
+{
+	const uint32_t slot = sequence++ & sequence_mask;
+	send_times[slot].store(now_stamp(), std::memory_order_relaxed);
+	return slot;
+}
+
+std::size_t resident_kilobytes()
+{
+#if defined(__linux__)
+	if(auto statm = std::fopen("/proc/self/statm", "r"))
+	{
+		unsigned long size = 0, resident = 0;
+		const bool read = std::fscanf(statm, "%lu %lu", &size, &resident) == 2;
+		std::fclose(statm);
+		if(read)
+			return resident * 4; // assuming 4KiB pages
+	}
+#endif
+	return 0;
+}
+
+struct load
+{
+	double mouse_rate;
+	int fingers;
+	double touch_rate;
+	double key_rate;
+};
+
+struct producer_stats
+{
+	std::atomic<std::size_t> pushed{0};
+	std::atomic<std::size_t> failed{0};
+};
+
+void produce(const load& load, const std::atomic<bool>& run, producer_stats& stats)
+{
+	std::minstd_rand random(0);
+	std::size_t mice = 0, touches = 0, keys = 0;
+	uint32_t sequence = 0;
+	std::vector<bool> finger_down(load.fingers, false);
+	bool key_down = false;
+
+	auto push = [&stats](SDL_Event& event)
+	{
+		if(SDL_PushEvent(&event) == 1)
+			++stats.pushed;
+		else
+			++stats.failed;
+	};
+
+	while(run)
+	{
+		const double elapsed = std::chrono::duration<double>(clock_type::now() - start_time).count();
+
+		for(; mice < elapsed * load.mouse_rate; ++mice)
+		{
+			SDL_Event event{};
+			event.type = SDL_MOUSEMOTION;
+			event.motion.which = mouse_device;
+			event.motion.windowID = stamp(sequence);
+			event.motion.xrel = int(random() % 7) - 3;
+			event.motion.yrel = int(random() % 7) - 3;
+			event.motion.x = int(mice % 640);
+			event.motion.y = int(mice % 480);
+			push(event);
+		}
+
+		for(; touches < elapsed * load.touch_rate * load.fingers; ++touches)
+		{
+			const int finger = int(touches % load.fingers);
+			SDL_Event event{};
+			event.type = finger_down[finger]
+				? (random() % 64 == 0 ? SDL_FINGERUP : SDL_FINGERMOTION)
+				: SDL_FINGERDOWN;
+			finger_down[finger] = event.type != SDL_FINGERUP;
+			event.tfinger.touchId = touch_device;
+			event.tfinger.fingerId = finger;
+			event.tfinger.x = float(random() % 1000) / 1000;
+			event.tfinger.y = float(random() % 1000) / 1000;
+			event.tfinger.pressure = float(stamp(sequence));
+			push(event);
+		}
+
+		for(; keys < elapsed * load.key_rate; ++keys)
+		{
+			SDL_Event event{};
+			event.type = key_down ? SDL_KEYUP : SDL_KEYDOWN;
+			event.key.state = key_down ? SDL_RELEASED : SDL_PRESSED;
+			event.key.keysym.scancode = SDL_Scancode(SDL_SCANCODE_A + keys / 2 % 26);
+			event.key.keysym.sym = SDL_GetKeyFromScancode(event.key.keysym.scancode);
+			event.key.windowID = stamp(sequence);
+			key_down = !key_down;
+			push(event);
+		}
+
+		std::this_thread::sleep_for(100us);
+	}
+}
+
+uint32_t sent_stamp(const event& e)
+{
+	const uint32_t slot = std::visit([](auto&& e) -> uint32_t
+	{
+		using data_type = std::decay_t<decltype(e.data)>;
+		if constexpr (std::is_same_v<data_type, pointer_data>)
+			return uint32_t(e.data.pressure);
+		else if constexpr (std::is_same_v<data_type, key_data> || std::is_same_v<data_type, mouse_motion_data>)
+			return e.data.window_id;
+		else
+			return UINT32_MAX;
+	}, e);
+	return slot > sequence_mask ? UINT32_MAX : send_times[slot].load(std::memory_order_relaxed);
+}
+
+void report(double seconds, std::vector<uint32_t>& latencies, std::size_t received, std::size_t pushed, std::size_t failed)
+{
+	const auto stats = queue_pressure();
+	auto percentile = [&latencies](double p) -> unsigned
+	{
+		if(latencies.empty())
+			return 0;
+		auto nth = latencies.begin() + std::size_t(p * (latencies.size() - 1));
+		std::nth_element(latencies.begin(), nth, latencies.end());
+		return *nth;
+	};
+
+	std::printf("%8.1fs %10zu pushed %8zu failed %10zu received %8zu dropped %6zu peak depth"
+		" | latency us p50 %6u p90 %6u p99 %6u p99.9 %6u max %6u | rss %zu KiB\n",
+		seconds, pushed, failed, received, stats.dropped, stats.peak_depth,
+		percentile(.5), percentile(.9), percentile(.99), percentile(.999), percentile(1),
+		resident_kilobytes());
+	std::fflush(stdout);
+	latencies.clear();
+}
+
+int main(int argc, char const* argv[]) try
+{
+	using simple::support::ston;
+	const auto duration = std::chrono::seconds(argc > 1 ? ston<int>(argv[1]) : 10);
+	const load load
+	{
+		argc > 2 ? ston<double>(argv[2]) : 8000,
+		argc > 3 ? ston<int>(argv[3]) : 10,
+		argc > 4 ? ston<double>(argv[4]) : 240,
+		argc > 5 ? ston<double>(argv[5]) : 50
+	};
+
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", false);
+
+	initializer init;
+	sdl_input_grabber input_grabber;
+	track_queue_pressure(true);
+
+	std::atomic<bool> run = true;
+	producer_stats pushed;
+	std::thread producer(produce, std::cref(load), std::cref(run), std::ref(pushed));
+
+	// the usual consumer side, reusing the buffers
+	std::vector<event> events;
+	std::vector<uint32_t> latencies;
+	latencies.reserve(1 << 20);
+	mouse_state_table mice;
+	motion_accumulator motion;
+	std::size_t received = 0;
+
+	auto last_report = clock_type::now();
+	while(clock_type::now() - start_time < duration)
+	{
+		events.clear();
+		pump();
+		received += drain_events(events, no_pump);
+		const uint32_t now = now_stamp();
+
+		for(auto& e : events)
+			if(auto sent = sent_stamp(e); sent != UINT32_MAX)
+				latencies.push_back(now - sent);
+
+		mice.update(events);
+		motion.feed(events);
+		mice.reset_wheel();
+		motion.take_whole(mouse_device);
+
+		if(clock_type::now() - last_report >= 1s)
+		{
+			last_report = clock_type::now();
+			report(std::chrono::duration<double>(last_report - start_time).count(),
+				latencies, received, pushed.pushed, pushed.failed);
+		}
+
+		std::this_thread::sleep_for(1ms);
+	}
+
+	run = false;
+	producer.join();
+	return 0;
+}
+catch(...)
+{
+	if(errno)
+		std::perror("ERROR");
+
+	const char* sdl_error = SDL_GetError();
+	if(*sdl_error)
+		std::puts(sdl_error);
+
+	throw;
+}
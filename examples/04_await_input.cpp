@@ -0,0 +1,77 @@
+#include <cstdio>
+#include <thread>
+#include <chrono>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/await.h"
+#include "simple/interactive/names.h"
+#include "common/sdl_input_grabber.h"
+
+#include "common/sdl_input_grabber.cpp"
+
+// Input as a sequence of steps, with coroutines, so needs C++20:
+// make CXXFLAGS=--std=c++20
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+#if defined(SIMPLE_INTERACTIVE_COROUTINES)
+
+input_task press_then_click(event_waiters& input, int& clicks)
+{
+	std::puts("Press any key!");
+	const auto key = co_await input.next<key_pressed>();
+	const auto name = to_string(key.data.keycode);
+	std::printf("%.*s it is. Now click a few times, any key to quit.\n", int(name.size()), name.data());
+
+	while(true)
+	{
+		const auto e = co_await input.any_of<mouse_down, key_pressed, quit_request>();
+		if(!std::holds_alternative<mouse_down>(e))
+			break;
+		++clicks;
+		std::printf("click %d\n", clicks);
+	}
+}
+
+int main() try
+{
+
+	initializer init;
+
+	sdl_input_grabber input_grabber;
+	event_waiters input;
+	int clicks = 0;
+
+	// runs up to the first co_await, then goes on as the events are dispatched
+	auto task = press_then_click(input, clicks);
+	while(!task.done())
+	{
+		input.dispatch_pending();
+		std::this_thread::sleep_for(20ms);
+	}
+
+	std::printf("%d clicks\n", clicks);
+	return 0;
+}
+catch(...)
+{
+	if(errno)
+		std::perror("ERROR");
+
+	const char* sdl_error = SDL_GetError();
+	if(*sdl_error)
+		std::puts(sdl_error);
+
+	throw;
+}
+
+#else
+
+int main()
+{
+	std::puts("Built without coroutines, try again with C++20.");
+	return 0;
+}
+
+#endif
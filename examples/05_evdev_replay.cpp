@@ -0,0 +1,87 @@
+#include <cstdio>
+
+#include "simple/interactive/evdev.h"
+#include "simple/interactive/names.h"
+
+// Replays recorded linux input_event records, from a file or standard input, and prints the events.
+// Record some input with (as root, or a member of the input group):
+//   cat /dev/input/event3 > mouse.rec
+// then replay it without the device:
+//   05_evdev_replay mouse.rec
+// or watch it live through a pipe:
+//   cat /dev/input/event3 | 05_evdev_replay
+
+using namespace simple::interactive;
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+
+void print_name(std::string_view name)
+{
+	std::printf(" %.*s", int(name.size()), name.data());
+}
+
+int main(int argc, char const* argv[])
+{
+	const int fd = argc > 1 ? open(argv[1], O_RDONLY) : STDIN_FILENO;
+	if(fd < 0)
+	{
+		std::perror("ERROR");
+		return 1;
+	}
+
+	evdev_source source(fd);
+	std::size_t count = 0;
+	// a blocking descriptor only runs out at the end of the file or pipe
+	while(auto e = source.next_event())
+	{
+		++count;
+		std::printf("%12.3fms", precise_timestamp(*e).count() / 1000.0);
+		std::visit([](auto&& e)
+		{
+			using event_type = std::decay_t<decltype(e)>;
+			if constexpr (std::is_base_of_v<key_event, event_type>)
+			{
+				std::printf(" key %s", e.data.state == keystate::pressed ? "down" : "up");
+				print_name(to_string(e.data.scancode));
+				if(e.data.repeat)
+					std::printf(" (repeat)");
+			}
+			else if constexpr (std::is_same_v<event_type, mouse_motion>)
+				std::printf(" mouse motion %d %d", e.data.motion.x(), e.data.motion.y());
+			else if constexpr (std::is_base_of_v<mouse_button_event, event_type>)
+			{
+				std::printf(" mouse %s", e.data.state == keystate::pressed ? "down" : "up");
+				print_name(to_string(e.data.button));
+			}
+			else if constexpr (std::is_same_v<event_type, mouse_wheel>)
+				std::printf(" mouse wheel %d %d", e.data.position.x(), e.data.position.y());
+			else if constexpr (std::is_same_v<std::decay_t<decltype(e.data)>, pointer_data>)
+			{
+				const char* what = std::is_same_v<event_type, pointer_down> ? "down"
+					: std::is_same_v<event_type, pointer_up> ? "up" : "motion";
+				std::printf(" pointer %lld %s %.3f %.3f", (long long)e.data.pointer_id, what,
+					e.data.position.x(), e.data.position.y());
+			}
+			else
+				std::printf(" other");
+		}, *e);
+		std::puts("");
+	}
+
+	std::printf("%zu events\n", count);
+	if(fd != STDIN_FILENO)
+		close(fd);
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::puts("evdev is linux only.");
+	return 0;
+}
+
+#endif
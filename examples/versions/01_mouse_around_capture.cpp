@@ -5,6 +5,7 @@
 
 #include "simple/interactive/initializer.h"
 #include "simple/interactive/event.h"
+#include "simple/interactive/changes.h"
 #include "simple/support/function_utils.hpp"
 #include "simple/support/misc.hpp"
 #include "../common/sdl_input_grabber.h"
@@ -33,25 +34,42 @@ int main(int argc, char const* argv[]) try
 	require_mouse_capture(true);
 
 	float2 cursor_position{};
+	change_tracker changes;
+
+	std::puts("\nPress any key or click to quit.");
+	render_screen(int2(screen_size), int2(cursor_position), ' ', '*', break_lines);
 
 	bool run = true;
 	while(run)
 	{
-		while(auto e = next_event()) std::visit( simple::support::overloaded{
-			[&cursor_position, &screen_size](const mouse_motion& event)
-			{
-				cursor_position = screen_size * event.screen_normalized_position().value();
-			},
-			[&run](mouse_up)
-			{
-				run = false;
-			},
-			[&run](key_pressed)
-			{
-				run = false;
-			},
-			[](auto) { }
-		}, *e);
+		pump();
+		while(auto e = next_event(no_pump))
+		{
+			changes.update(*e);
+			std::visit( simple::support::overloaded{
+				[&cursor_position, &screen_size](const mouse_motion& event)
+				{
+					cursor_position = screen_size * event.screen_normalized_position().value();
+				},
+				[&run](mouse_up)
+				{
+					run = false;
+				},
+				[&run](key_pressed)
+				{
+					run = false;
+				},
+				[](auto) { }
+			}, *e);
+		}
+
+		// nothing moved, nothing to redraw, sleep until something does
+		if(!changes.changed())
+		{
+			wait_for_events();
+			continue;
+		}
+		changes.clear();
 
 		std::puts("\nPress any key or click to quit.");
 		render_screen(int2(screen_size), int2(cursor_position), ' ', '*', break_lines);
@@ -2,11 +2,14 @@
 #include <thread>
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include "simple/interactive/initializer.h"
 #include "simple/interactive/event.h"
+#include "simple/interactive/motion.h"
 #include "simple/support/function_utils.hpp"
 #include "simple/support/misc.hpp"
+#include "simple/sdlcore/utils.hpp"
 #include "../common/sdl_input_grabber.h"
 
 #include "../common/sdl_input_grabber.cpp"
@@ -33,20 +36,26 @@ int main(int argc, char const* argv[]) try
 	input_grabber.grab();
 	relative_mouse_mode(true);
 
+	// normalize the motion to the screen once, instead of for every sample
+	SDL_DisplayMode display;
+	simple::sdlcore::utils::throw_error(SDL_GetCurrentDisplayMode(0, &display));
+	motion_accumulator mouse;
+	mouse.default_curve({screen_size / static_cast<float2>(int2{display.w, display.h})});
+
 	float2 cursor_position{};
+	std::vector<event> events;
 
 	bool run = true;
 	while(run)
 	{
-		while(auto e = next_event()) std::visit( simple::support::overloaded{
-			[&cursor_position, &screen_size](const mouse_motion& event)
-			{
-				// using value_or here since SDL sends motion events with invalid window id until window gains focus for the first time,
-				// and screen_normalized_motion selects the screen/display based on the window id.
-				const float2 motion = event.screen_normalized_motion().value_or(float2{});
-				cursor_position += screen_size * motion;
-				cursor_position.clamp(float2::zero(), screen_size - 1);
-			},
+		events.clear();
+		drain_events(events);
+
+		mouse.feed(events);
+		cursor_position += mouse.take();
+		cursor_position.clamp(float2::zero(), screen_size - 1);
+
+		for(auto&& e : events) std::visit( simple::support::overloaded{
 			[&run](mouse_up)
 			{
 				run = false;
@@ -56,7 +65,7 @@ int main(int argc, char const* argv[]) try
 				run = false;
 			},
 			[](auto) { }
-		}, *e);
+		}, e);
 
 		std::puts("\nPress any key or click to quit.");
 		render_screen(int2(screen_size), int2(cursor_position), ' ', '*', break_lines);
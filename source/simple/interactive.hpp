@@ -1,3 +1,23 @@
+#include "interactive/allocation_audit.h"
+#include "interactive/await.h"
+#include "interactive/broadcast_ring.hpp"
+#include "interactive/changes.h"
+#include "interactive/coalesce.h"
 #include "interactive/codes.h"
 #include "interactive/event.h"
+#include "interactive/event_history.h"
+#include "interactive/event_ref.h"
+#include "interactive/frame_arena.h"
 #include "interactive/initializer.h"
+#include "interactive/input_log.h"
+#include "interactive/input_stream.h"
+#include "interactive/key_repeat.h"
+#include "interactive/late_latch.h"
+#include "interactive/motion.h"
+#include "interactive/motion_history.h"
+#include "interactive/mouse_state.h"
+#include "interactive/names.h"
+#include "interactive/normalize.h"
+#include "interactive/queue.h"
+#include "interactive/readiness.h"
+#include "interactive/router.h"
@@ -0,0 +1,105 @@
+#include "allocation_audit.h"
+
+#if defined(SIMPLE_INTERACTIVE_ALLOCATION_AUDIT)
+#include <new>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+namespace simple::interactive
+{
+
+#if defined(SIMPLE_INTERACTIVE_ALLOCATION_AUDIT)
+
+	void abort_on_allocation(std::size_t size)
+	{
+		std::fprintf(stderr, "allocation of %zu bytes inside an allocation free section\n", size);
+		std::abort();
+	}
+
+	thread_local unsigned allocation_free_depth = 0;
+	std::atomic<std::size_t> allocations_in_sections{0};
+	std::atomic<allocation_handler> on_allocation{abort_on_allocation};
+
+	void audit_allocation(std::size_t size)
+	{
+		if(allocation_free_depth == 0)
+			return;
+
+		allocations_in_sections.fetch_add(1, std::memory_order_relaxed);
+		if(auto handler = on_allocation.load(std::memory_order_relaxed))
+		{
+			// the handler is free to allocate
+			const unsigned depth = allocation_free_depth;
+			allocation_free_depth = 0;
+			handler(size);
+			allocation_free_depth = depth;
+		}
+	}
+
+	bool allocation_audit_enabled() noexcept
+	{
+		return true;
+	}
+
+	allocation_free::allocation_free() noexcept
+	{
+		++allocation_free_depth;
+	}
+
+	allocation_free::~allocation_free()
+	{
+		--allocation_free_depth;
+	}
+
+	std::size_t audited_allocations() noexcept
+	{
+		return allocations_in_sections.load(std::memory_order_relaxed);
+	}
+
+	void allocation_audit_handler(allocation_handler handler) noexcept
+	{
+		on_allocation.store(handler, std::memory_order_relaxed);
+	}
+
+#else
+
+	bool allocation_audit_enabled() noexcept { return false; }
+	allocation_free::allocation_free() noexcept {}
+	allocation_free::~allocation_free() {}
+	std::size_t audited_allocations() noexcept { return 0; }
+	void allocation_audit_handler(allocation_handler) noexcept {}
+
+#endif
+
+} // namespace simple::interactive
+
+#if defined(SIMPLE_INTERACTIVE_ALLOCATION_AUDIT)
+
+// the array and nothrow forms call these by default
+
+void* operator new(std::size_t size)
+{
+	simple::interactive::audit_allocation(size);
+	if(void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	simple::interactive::audit_allocation(size);
+	const auto align = static_cast<std::size_t>(alignment);
+	// aligned_alloc wants a multiple of the alignment
+	if(void* memory = std::aligned_alloc(align, (size + align - 1) / align * align))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+
+#endif
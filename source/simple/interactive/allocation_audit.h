@@ -0,0 +1,40 @@
+#ifndef SIMPLE_INTERACTIVE_ALLOCATION_AUDIT_H
+#define SIMPLE_INTERACTIVE_ALLOCATION_AUDIT_H
+#include <cstddef>
+
+namespace simple::interactive
+{
+
+	// When the library is built with SIMPLE_INTERACTIVE_ALLOCATION_AUDIT defined,
+	// it replaces the global allocation functions, and any allocation made by a thread
+	// while it's inside an allocation_free section is counted and reported to the handler.
+	// The event path (next_event, drains, dispatch, the trackers) is meant to pass this after warm up,
+	// once buffers have grown to their steady state sizes.
+	// Otherwise sections do nothing, and nothing is ever counted.
+	// Only the global allocation functions (operator new and delete) are replaced, malloc is not,
+	// so what SDL allocates for itself (with SDL_malloc) is never counted.
+
+	// true if the library was built with auditing
+	bool allocation_audit_enabled() noexcept;
+
+	// marks the current thread as being in an input section, for its lifetime, can be nested
+	class allocation_free
+	{
+		public:
+		allocation_free() noexcept;
+		allocation_free(const allocation_free&) = delete;
+		allocation_free& operator=(const allocation_free&) = delete;
+		~allocation_free();
+	};
+
+	// allocations made inside sections, by any thread, since start
+	std::size_t audited_allocations() noexcept;
+
+	// called with the size of every audited allocation, before it's made, outside of any section,
+	// the default prints the size and aborts, nullptr only counts
+	using allocation_handler = void (*)(std::size_t size);
+	void allocation_audit_handler(allocation_handler) noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,78 @@
+#include "await.h"
+
+namespace simple::interactive
+{
+
+	void event_waiter::unlink() noexcept
+	{
+		if(!next)
+			return;
+		prev->next = next;
+		next->prev = prev;
+		prev = next = nullptr;
+	}
+
+	bool event_waiter::linked() const noexcept
+	{
+		return next;
+	}
+
+	event_waiters::event_waiters() noexcept
+	{
+		for(auto& list : lists)
+			list.prev = list.next = &list;
+	}
+
+	void event_waiters::wait(std::size_t event_index, event_waiter& waiter) noexcept
+	{
+		waiter.unlink();
+		auto& list = lists[event_index];
+		waiter.prev = list.prev;
+		waiter.next = &list;
+		list.prev->next = &waiter;
+		list.prev = &waiter;
+	}
+
+	bool event_waiters::waiting(std::size_t event_index) const noexcept
+	{
+		const auto& list = lists[event_index];
+		return list.next != &list;
+	}
+
+	std::size_t event_waiters::dispatch(const event& e)
+	{
+		auto& list = lists[e.index()];
+		if(list.next == &list)
+			return 0;
+
+		// move the waiters to a local list, so that the ones added while notifying wait for the next event,
+		// while destroying any of them (along with a coroutine) still unlinks properly
+		event_waiter ready;
+		ready.next = list.next;
+		ready.prev = list.prev;
+		ready.next->prev = &ready;
+		ready.prev->next = &ready;
+		list.prev = list.next = &list;
+
+		std::size_t count = 0;
+		while(ready.next != &ready)
+		{
+			auto& waiter = *ready.next;
+			waiter.unlink();
+			waiter.notify(waiter, e);
+			++count;
+		}
+		return count;
+	}
+
+	std::size_t event_waiters::dispatch_pending()
+	{
+		grow_spill();
+		begin_drain();
+		std::size_t count = 0;
+		while(auto e = next_event())
+			count += dispatch(*e);
+		return count;
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,223 @@
+#ifndef SIMPLE_INTERACTIVE_AWAIT_H
+#define SIMPLE_INTERACTIVE_AWAIT_H
+#include <array>
+#include <exception>
+#include <utility>
+#include "event.h"
+
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#define SIMPLE_INTERACTIVE_COROUTINES
+#endif
+
+namespace simple::interactive
+{
+
+	// A node in the list of waiters for one type of event.
+	// Lives wherever the waiter does (the coroutine frame, when awaiting), so waiting doesn't allocate.
+	class event_waiter
+	{
+		public:
+		event_waiter() noexcept = default;
+		event_waiter(const event_waiter&) = delete;
+		event_waiter& operator=(const event_waiter&) = delete;
+		~event_waiter() { unlink(); }
+
+		void unlink() noexcept;
+		bool linked() const noexcept;
+
+		// called at most once per wait, after the waiter is unlinked
+		void (*notify)(event_waiter&, const event&) = nullptr;
+
+		private:
+		friend class event_waiters;
+		event_waiter* prev = nullptr;
+		event_waiter* next = nullptr;
+	};
+
+	// Keeps waiters in a separate list for each event type,
+	// so an event only ever touches the waiters of its own type.
+	class event_waiters
+	{
+		public:
+		event_waiters() noexcept;
+		event_waiters(const event_waiters&) = delete;
+		event_waiters& operator=(const event_waiters&) = delete;
+
+		void wait(std::size_t event_index, event_waiter&) noexcept;
+
+		template <typename Event>
+		void wait(event_waiter& waiter) noexcept
+		{
+			wait(event_index<Event>, waiter);
+		}
+
+		bool waiting(std::size_t event_index) const noexcept;
+
+		// notifies all the waiters for the type of the event,
+		// waiters added in the process wait for the next one,
+		// returns the number of waiters notified
+		std::size_t dispatch(const event&);
+
+		template <typename Events>
+		std::size_t dispatch(const Events& events)
+		{
+			std::size_t count = 0;
+			for(auto&& e : events)
+				count += dispatch(e);
+			return count;
+		}
+
+		// dispatches everything next_event() has to offer
+		std::size_t dispatch_pending();
+
+#if defined(SIMPLE_INTERACTIVE_COROUTINES)
+		template <typename Event>
+		class next_awaitable;
+
+		template <typename... Events>
+		class any_of_awaitable;
+
+		// co_await input.next<key_pressed>() resumes with the next key_pressed
+		template <typename Event>
+		next_awaitable<Event> next() noexcept { return next_awaitable<Event>(*this); }
+
+		// co_await input.any_of<mouse_up, quit_request>() resumes with whichever comes first, as an event
+		template <typename... Events>
+		any_of_awaitable<Events...> any_of() noexcept { return any_of_awaitable<Events...>(*this); }
+#endif
+
+		private:
+		// circular, the head is a sentinel
+		std::array<event_waiter, std::variant_size_v<event>> lists;
+	};
+
+#if defined(SIMPLE_INTERACTIVE_COROUTINES)
+
+	template <typename Event>
+	class event_waiters::next_awaitable : private event_waiter
+	{
+		public:
+		explicit next_awaitable(event_waiters& waiters) noexcept : waiters(waiters) {}
+
+		bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle) noexcept
+		{
+			this->handle = handle;
+			notify = [](event_waiter& waiter, const event& e)
+			{
+				auto& self = static_cast<next_awaitable&>(waiter);
+				self.result.emplace(std::get<Event>(e));
+				self.handle.resume();
+			};
+			waiters.wait<Event>(*this);
+		}
+
+		Event await_resume() const { return *result; }
+
+		private:
+		event_waiters& waiters;
+		std::coroutine_handle<> handle;
+		std::optional<Event> result;
+	};
+
+	template <typename... Events>
+	class event_waiters::any_of_awaitable
+	{
+		public:
+		explicit any_of_awaitable(event_waiters& waiters) noexcept : waiters(waiters) {}
+
+		bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle) noexcept
+		{
+			this->handle = handle;
+			std::size_t i = 0;
+			((nodes[i].owner = this, nodes[i].notify = notify, waiters.wait<Events>(nodes[i++])), ...);
+		}
+
+		event await_resume() const { return *result; }
+
+		private:
+		struct node : event_waiter
+		{
+			any_of_awaitable* owner = nullptr;
+		};
+
+		static void notify(event_waiter& waiter, const event& e)
+		{
+			auto& self = *static_cast<node&>(waiter).owner;
+			for(auto& other : self.nodes)
+				other.unlink();
+			self.result.emplace(e);
+			self.handle.resume();
+		}
+
+		event_waiters& waiters;
+		std::coroutine_handle<> handle;
+		std::array<node, sizeof...(Events)> nodes;
+		std::optional<event> result;
+	};
+
+	// Starts right away, runs until the first co_await, then whenever the awaited event is dispatched.
+	// The frame is allocated once per task, not per await, and destroyed with the task.
+	class input_task
+	{
+		public:
+		struct promise_type
+		{
+			input_task get_return_object() noexcept
+			{
+				return input_task(std::coroutine_handle<promise_type>::from_promise(*this));
+			}
+			std::suspend_never initial_suspend() const noexcept { return {}; }
+			std::suspend_always final_suspend() const noexcept { return {}; }
+			void return_void() const noexcept {}
+			void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+			std::exception_ptr exception;
+		};
+
+		// inline, the library itself may be built without coroutines
+		input_task(input_task&& other) noexcept :
+			handle(std::exchange(other.handle, nullptr))
+		{}
+
+		input_task& operator=(input_task&& other) noexcept
+		{
+			if(handle)
+				handle.destroy();
+			handle = std::exchange(other.handle, nullptr);
+			return *this;
+		}
+
+		~input_task()
+		{
+			if(handle)
+				handle.destroy();
+		}
+
+		// rethrows the exception that ended the task, if any
+		bool done() const
+		{
+			if(!handle)
+				return true;
+			if(handle.promise().exception)
+				std::rethrow_exception(handle.promise().exception);
+			return handle.done();
+		}
+
+		private:
+		explicit input_task(std::coroutine_handle<promise_type> handle) noexcept :
+			handle(handle)
+		{}
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+#endif
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
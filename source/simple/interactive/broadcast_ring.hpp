@@ -0,0 +1,254 @@
+#ifndef SIMPLE_INTERACTIVE_BROADCAST_RING_HPP
+#define SIMPLE_INTERACTIVE_BROADCAST_RING_HPP
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace simple::interactive
+{
+
+	// Single producer, multiple consumer broadcast over a fixed power of two sized ring, disruptor style.
+	// Each element is written once, every consumer reads it in place, through its own cursor,
+	// and the slot is reused only after the slowest consumer has released it.
+	// The producer and each consumer can be on separate threads.
+	template <typename T>
+	class broadcast_ring
+	{
+		public:
+		using value_type = T;
+
+		broadcast_ring(std::size_t capacity, std::size_t consumers) :
+			cursors(std::make_unique<padded_cursor[]>(consumers)),
+			consumers(consumers)
+		{
+			std::size_t size = 1;
+			while(size < capacity)
+				size *= 2;
+			storage = std::make_unique<cell[]>(size);
+			mask = size - 1;
+		}
+
+		broadcast_ring(const broadcast_ring&) = delete;
+		broadcast_ring& operator=(const broadcast_ring&) = delete;
+
+		~broadcast_ring()
+		{
+			const uint64_t end = published.load(std::memory_order_relaxed);
+			for(uint64_t i = end > capacity() ? end - capacity() : 0; i < end; ++i)
+				slot(i)->~T();
+		}
+
+		std::size_t capacity() const noexcept { return mask + 1; }
+		std::size_t consumer_count() const noexcept { return consumers; }
+
+		// producer side
+
+		// false if the slowest consumer is a whole ring behind
+		template <typename... Args>
+		bool try_publish(Args&&... args)
+		{
+			const uint64_t next = published.load(std::memory_order_relaxed);
+			if(next - gate >= capacity())
+			{
+				gate = slowest();
+				if(next - gate >= capacity())
+					return false;
+			}
+
+			if(next >= capacity())
+				slot(next)->~T();
+			new (raw(next)) T(std::forward<Args>(args)...);
+			published.store(next + 1, std::memory_order_release);
+			return true;
+		}
+
+		// back pressure, waits for the slowest consumer to make room
+		template <typename... Args>
+		void publish(Args&&... args)
+		{
+			while(!try_publish(std::forward<Args>(args)...))
+				std::this_thread::yield();
+		}
+
+		// Never waits for the slowest consumers to catch up. The ones a whole ring behind are lapped,
+		// their oldest unread element is dropped and counted for them alone,
+		// while everyone gets the new one.
+		// A consumer can't be lapped in the middle of reading an element (see reading()),
+		// so this can wait for that one read to end.
+		// Returns the number of consumers lapped.
+		template <typename... Args>
+		std::size_t publish_or_drop(Args&&... args)
+		{
+			std::size_t lapped = 0;
+			const uint64_t next = published.load(std::memory_order_relaxed);
+			if(next - gate >= capacity())
+			{
+				gate = slowest();
+				if(next - gate >= capacity())
+					lapped = lap(next - capacity());
+			}
+			// there's room now
+			try_publish(std::forward<Args>(args)...);
+			return lapped;
+		}
+
+		// elements the consumer missed by being lapped
+		std::size_t dropped(std::size_t consumer) const noexcept
+		{
+			return cursors[consumer].dropped.load(std::memory_order_relaxed);
+		}
+
+		// all consumers together
+		std::size_t dropped() const noexcept
+		{
+			std::size_t total = 0;
+			for(std::size_t i = 0; i < consumers; ++i)
+				total += dropped(i);
+			return total;
+		}
+
+		// consumer side, each consumer index used by one thread at a time
+
+		// Keeps the producer from lapping the consumer while it lives.
+		// References from peek are only safe within one, if the producer uses publish_or_drop,
+		// consume takes one for each element by itself.
+		class read_guard
+		{
+			public:
+			read_guard(const read_guard&) = delete;
+			read_guard& operator=(const read_guard&) = delete;
+			~read_guard() { flag.store(false, std::memory_order_release); }
+
+			private:
+			friend class broadcast_ring;
+			explicit read_guard(std::atomic<bool>& flag) noexcept : flag(flag)
+			{
+				// the producer only ever holds it for a moment
+				while(flag.exchange(true, std::memory_order_acquire))
+					std::this_thread::yield();
+			}
+			std::atomic<bool>& flag;
+		};
+
+		read_guard reading(std::size_t consumer) noexcept
+		{
+			return read_guard(cursors[consumer].reading);
+		}
+
+		std::size_t available(std::size_t consumer) const noexcept
+		{
+			return published.load(std::memory_order_acquire)
+				- cursors[consumer].value.load(std::memory_order_relaxed);
+		}
+
+		// offset from the consumer's cursor, must be less than available
+		const T& peek(std::size_t consumer, std::size_t offset = 0) const noexcept
+		{
+			return *slot(cursors[consumer].value.load(std::memory_order_relaxed) + offset);
+		}
+
+		// done with the elements, the producer can reuse the slots once every consumer is done
+		void release(std::size_t consumer, std::size_t count = 1) noexcept
+		{
+			auto& cursor = cursors[consumer].value;
+			cursor.store(cursor.load(std::memory_order_relaxed) + count, std::memory_order_release);
+		}
+
+		// calls read(element) for everything available, in place, releasing each one after,
+		// returns the number of elements read, fewer than were available if lapped meanwhile
+		template <typename Read>
+		std::size_t consume(std::size_t consumer, Read&& read)
+		{
+			// guarding one element at a time, so that a slow reader can still be lapped in between
+			std::size_t count = 0;
+			for(std::size_t left = available(consumer); left != 0; --left)
+			{
+				const auto guard = reading(consumer);
+				if(available(consumer) == 0)
+					break;
+				read(peek(consumer));
+				release(consumer);
+				++count;
+			}
+			return count;
+		}
+
+		private:
+		using cell = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+		// separate cache lines, so consumers don't slow each other down
+		struct alignas(64) padded_cursor
+		{
+			std::atomic<uint64_t> value{0};
+			std::atomic<bool> reading{false};
+			std::atomic<std::size_t> dropped{0};
+		};
+
+		// moves every consumer still at the oldest element past it
+		std::size_t lap(uint64_t oldest) noexcept
+		{
+			std::size_t lapped = 0;
+			for(std::size_t i = 0; i < consumers; ++i)
+			{
+				auto& cursor = cursors[i];
+				if(cursor.value.load(std::memory_order_acquire) != oldest)
+					continue;
+
+				// consumers only hold it for one element at a time
+				while(cursor.reading.exchange(true, std::memory_order_acquire))
+					std::this_thread::yield();
+				// might have moved on before it let go
+				if(cursor.value.load(std::memory_order_relaxed) == oldest)
+				{
+					cursor.value.store(oldest + 1, std::memory_order_relaxed);
+					cursor.dropped.fetch_add(1, std::memory_order_relaxed);
+					++lapped;
+				}
+				cursor.reading.store(false, std::memory_order_release);
+			}
+			gate = oldest + 1;
+			return lapped;
+		}
+
+		uint64_t slowest() const noexcept
+		{
+			uint64_t result = published.load(std::memory_order_relaxed);
+			for(std::size_t i = 0; i < consumers; ++i)
+				result = std::min(result, cursors[i].value.load(std::memory_order_acquire));
+			return result;
+		}
+
+		void* raw(uint64_t index) noexcept
+		{
+			return &storage[index & mask];
+		}
+
+		T* slot(uint64_t index) noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(&storage[index & mask]));
+		}
+
+		const T* slot(uint64_t index) const noexcept
+		{
+			return std::launder(reinterpret_cast<const T*>(&storage[index & mask]));
+		}
+
+		std::unique_ptr<cell[]> storage;
+		std::size_t mask = 0;
+		std::unique_ptr<padded_cursor[]> cursors;
+		std::size_t consumers;
+
+		alignas(64) std::atomic<uint64_t> published{0};
+		// producer only, the slowest cursor as of the last look, to not scan them on every publish
+		uint64_t gate = 0;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,104 @@
+#include "changes.h"
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	static input_change change_of(const event& e) noexcept
+	{
+		return std::visit([](auto&& e)
+		{
+			using event_type = std::decay_t<decltype(e)>;
+			if constexpr (std::is_same_v<event_type, key_pressed>)
+				return e.data.repeat ? input_change::none : input_change::keys;
+			else if constexpr (std::is_base_of_v<key_event, event_type>
+				|| std::is_same_v<event_type, text_input>
+				|| std::is_same_v<event_type, text_edit>)
+				return input_change::keys;
+			else if constexpr (std::is_same_v<event_type, mouse_motion>)
+				return e.data.motion == int2::zero() ? input_change::none : input_change::cursor;
+			else if constexpr (std::is_same_v<event_type, mouse_wheel>)
+			{
+#if SDL_VERSION_ATLEAST(2,0,4)
+				return e.motion() == int2::zero() ? input_change::none : input_change::cursor;
+#else
+				return e.data.position == int2::zero() ? input_change::none : input_change::cursor;
+#endif
+			}
+			else if constexpr (std::is_base_of_v<mouse_data, std::decay_t<decltype(e.data)>>)
+				return input_change::cursor;
+			else if constexpr (std::is_same_v<std::decay_t<decltype(e.data)>, pointer_data>)
+				return input_change::touches;
+			else
+				return input_change::windows;
+		}, e);
+	}
+
+	static uint32_t focused_window() noexcept
+	{
+		auto window = SDL_GetMouseFocus();
+		if(!window)
+			window = SDL_GetKeyboardFocus();
+		return window ? SDL_GetWindowID(window) : 0;
+	}
+
+	change_tracker::change_tracker(std::size_t windows)
+	{
+		this->windows.reserve(windows);
+	}
+
+	input_change change_tracker::update(const event& e)
+	{
+		const auto change = change_of(e);
+		if(change == input_change::none)
+			return change;
+
+		changes_ = changes_ | change;
+		auto id = window_id(e);
+		if(id == 0 && change == input_change::touches)
+			id = focused_window();
+		if(id == 0)
+			everywhere = true;
+		else if(std::find(windows.begin(), windows.end(), id) == windows.end())
+			windows.push_back(id);
+		return change;
+	}
+
+	input_change change_tracker::changes() const noexcept
+	{
+		return changes_;
+	}
+
+	bool change_tracker::changed() const noexcept
+	{
+		return changes_ != input_change::none;
+	}
+
+	bool change_tracker::changed(input_change categories) const noexcept
+	{
+		return changes_ && categories;
+	}
+
+	const std::vector<uint32_t>& change_tracker::dirty_windows() const noexcept
+	{
+		return windows;
+	}
+
+	bool change_tracker::dirty(uint32_t window_id) const noexcept
+	{
+		return everywhere || std::find(windows.begin(), windows.end(), window_id) != windows.end();
+	}
+
+	bool change_tracker::dirty_everywhere() const noexcept
+	{
+		return everywhere;
+	}
+
+	void change_tracker::clear() noexcept
+	{
+		changes_ = input_change::none;
+		windows.clear();
+		everywhere = false;
+	}
+
+} // namespace simple::interactive
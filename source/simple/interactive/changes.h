@@ -0,0 +1,78 @@
+#ifndef SIMPLE_INTERACTIVE_CHANGES_H
+#define SIMPLE_INTERACTIVE_CHANGES_H
+#include <vector>
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	enum class input_change : uint8_t
+	{
+		none = 0,
+		// mouse motion, buttons and wheel
+		cursor = 1 << 0,
+		// key presses and releases, text input and editing
+		keys = 1 << 1,
+		// pointer (touch and pen) events
+		touches = 1 << 2,
+		// window events and quit requests
+		windows = 1 << 3,
+		all = cursor | keys | touches | windows
+	};
+
+} // namespace simple::interactive
+
+template<> struct simple::support::define_enum_flags_operators<simple::interactive::input_change>
+	: std::true_type {};
+
+namespace simple::interactive
+{
+
+	// Collects what the events since the last clear() changed, to skip rendering frames where nothing did.
+	// Events that don't change anything observable are ignored: key repeats, and motion or wheel that doesn't move.
+	// Windows the changes happened in are listed as dirty, to redraw only those.
+	// Touches don't say which window they are in, they go to the window with the mouse focus (SDL puts its
+	// emulated mouse events there too), or the keyboard focus. Changes that still end up without a window
+	// (evdev input, quit, touches with nothing focused) make every window dirty, see dirty_everywhere().
+	// When nothing changed, wait_for_events() can block until something might have.
+	class change_tracker
+	{
+		public:
+		// room for this many dirty windows is made up front, so updating doesn't allocate
+		explicit change_tracker(std::size_t windows = 16);
+
+		// returns what the event changed
+		input_change update(const event&);
+
+		template <typename Events>
+		input_change update(const Events& events)
+		{
+			input_change changes = input_change::none;
+			for(auto&& e : events)
+				changes = changes | update(e);
+			return changes;
+		}
+
+		input_change changes() const noexcept;
+		bool changed() const noexcept;
+		bool changed(input_change categories) const noexcept;
+
+		// in the order they were first changed, not all of them if dirty_everywhere()
+		const std::vector<uint32_t>& dirty_windows() const noexcept;
+		// always true if dirty_everywhere()
+		bool dirty(uint32_t window_id) const noexcept;
+		// something changed that isn't tied to a window, so redraw everything
+		bool dirty_everywhere() const noexcept;
+
+		// once everything is rendered
+		void clear() noexcept;
+
+		private:
+		input_change changes_ = input_change::none;
+		std::vector<uint32_t> windows;
+		bool everywhere = false;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,105 @@
+#include "coalesce.h"
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	const window_vector_data* coalescable(const event& e) noexcept
+	{
+		if(auto moved = std::get_if<window_moved>(&e))
+			return &moved->data;
+		if(auto resized = std::get_if<window_resized>(&e))
+			return &resized->data;
+		if(auto size_changed = std::get_if<window_size_changed>(&e))
+			return &size_changed->data;
+		return nullptr;
+	}
+
+	// exposed, entered, shown and the like come interleaved with resizes, so they can't be barriers,
+	// or nothing would ever be coalesced
+	bool coalescing_barrier(const event& e) noexcept
+	{
+		switch(e.index())
+		{
+			case event_index<quit_request>:
+			case event_index<window_focus_gained>:
+			case event_index<window_focus_lost>:
+			case event_index<window_closed>:
+#if SDL_VERSION_ATLEAST(2,0,5)
+			case event_index<window_take_focus>:
+#endif
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	std::size_t window_coalescer::mark(const event* events, std::size_t count)
+	{
+		keep.assign(count, true);
+		seen.clear();
+
+		// backwards, so the first one seen is the one to keep
+		std::size_t removed = 0;
+		for(std::size_t i = count; i-- > 0;)
+		{
+			const auto& e = events[i];
+			if(coalescing_barrier(e))
+			{
+				seen.clear();
+				continue;
+			}
+
+			auto data = coalescable(e);
+			if(!data)
+				continue;
+
+			const seen_event current{data->window_id, e.index()};
+			const bool duplicate = std::any_of(seen.begin(), seen.end(), [&](auto& other)
+			{
+				return other.window_id == current.window_id && other.index == current.index;
+			});
+
+			if(duplicate)
+			{
+				keep[i] = false;
+				++removed;
+			}
+			else
+				seen.push_back(current);
+		}
+
+		return removed;
+	}
+
+	template <typename Events>
+	void window_coalescer::compact(Events& events, Events& kept)
+	{
+		kept.clear();
+		for(std::size_t i = 0; i < events.size(); ++i)
+			if(keep[i])
+				kept.push_back(std::move(events[i]));
+		events.swap(kept);
+	}
+
+	std::size_t window_coalescer::coalesce(std::vector<event>& events)
+	{
+		const std::size_t removed = mark(events.data(), events.size());
+		if(removed != 0)
+			compact(events, kept);
+		return removed;
+	}
+
+	std::size_t window_coalescer::coalesce(arena_vector<event>& events)
+	{
+		const std::size_t removed = mark(events.data(), events.size());
+		if(removed != 0)
+		{
+			arena_vector<event> arena_kept(events.get_allocator());
+			arena_kept.reserve(events.size() - removed);
+			compact(events, arena_kept);
+		}
+		return removed;
+	}
+
+} // namespace simple::interactive
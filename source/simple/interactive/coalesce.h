@@ -0,0 +1,43 @@
+#ifndef SIMPLE_INTERACTIVE_COALESCE_H
+#define SIMPLE_INTERACTIVE_COALESCE_H
+#include <vector>
+#include "event.h"
+#include "frame_arena.h"
+
+namespace simple::interactive
+{
+
+	// Thins out window_moved, window_resized and window_size_changed storms in a drained batch,
+	// keeping only the last of each kind for each window, where it was.
+	// Focus changes, closing and quit_request are barriers, nothing is coalesced across them,
+	// so those keep seeing the same sizes and positions before and after them as they would otherwise.
+	// Other window events and input events pass through untouched.
+	class window_coalescer
+	{
+		public:
+		// returns the number of events removed
+		std::size_t coalesce(std::vector<event>& events);
+		// what's left is moved to a new vector in the same arena
+		std::size_t coalesce(arena_vector<event>& events);
+
+		private:
+		std::size_t mark(const event* events, std::size_t count);
+
+		template <typename Events>
+		void compact(Events& events, Events& kept);
+
+		struct seen_event
+		{
+			uint32_t window_id;
+			std::size_t index;
+		};
+
+		// kept between calls, to not allocate every drain
+		std::vector<seen_event> seen;
+		std::vector<bool> keep;
+		std::vector<event> kept;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
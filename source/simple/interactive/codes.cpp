@@ -1,4 +1,7 @@
 #include "codes.h"
+#include <array>
+#include <utility>
+#include <algorithm>
 #include "simple/support/enum.hpp"
 
 using simple::support::to_integer;
@@ -6,15 +9,134 @@ using simple::support::to_integer;
 namespace simple::interactive
 {
 
+	// fixed size, so building never allocates
+	struct keymap_tables
+	{
+		std::array<keycode, SDL_NUM_SCANCODES> keycodes;
+		// keycodes without a character are scancodes with a mask bit set
+		std::array<scancode, SDL_NUM_SCANCODES> masked_scancodes;
+		std::array<scancode, 256> latin_scancodes;
+		// characters from other scripts, sorted, at most one for each scancode
+		std::array<std::pair<SDL_Keycode, scancode>, SDL_NUM_SCANCODES> other_scancodes;
+		std::size_t other_count = 0;
+
+		void build() noexcept
+		{
+			masked_scancodes.fill(scancode::unknown);
+			latin_scancodes.fill(scancode::unknown);
+			other_count = 0;
+
+			for(int code = 0; code < SDL_NUM_SCANCODES; ++code)
+			{
+				const SDL_Keycode key = SDL_GetKeyFromScancode(static_cast<SDL_Scancode>(code));
+				keycodes[code] = static_cast<keycode>(key);
+			}
+
+			// the first scancode producing a key wins, same as SDL_GetScancodeFromKey
+			for(int code = 0; code < SDL_NUM_SCANCODES; ++code)
+			{
+				const SDL_Keycode key = to_integer(keycodes[code]);
+				if(key == SDLK_UNKNOWN)
+					continue;
+
+				const auto scan = static_cast<scancode>(code);
+				scancode* entry = nullptr;
+				if(key & SDLK_SCANCODE_MASK)
+				{
+					const auto index = key & ~SDLK_SCANCODE_MASK;
+					if(index < SDL_NUM_SCANCODES)
+						entry = &masked_scancodes[index];
+				}
+				else if(key >= 0 && key < SDL_Keycode(latin_scancodes.size()))
+					entry = &latin_scancodes[key];
+				else
+					other_scancodes[other_count++] = {key, scan};
+
+				if(entry && *entry == scancode::unknown)
+					*entry = scan;
+			}
+
+			// by scancode among equal keys, so that unique keeps the first
+			auto key_less = [](auto& a, auto& b)
+			{
+				return a.first != b.first ? a.first < b.first : to_integer(a.second) < to_integer(b.second);
+			};
+			auto key_equal = [](auto& a, auto& b) { return a.first == b.first; };
+			const auto others = other_scancodes.begin() + other_count;
+			std::sort(other_scancodes.begin(), others, key_less);
+			other_count = std::unique(other_scancodes.begin(), others, key_equal) - other_scancodes.begin();
+		}
+
+		scancode lookup(keycode code) const noexcept
+		{
+			const SDL_Keycode key = to_integer(code);
+			if(key & SDLK_SCANCODE_MASK)
+			{
+				const auto index = key & ~SDLK_SCANCODE_MASK;
+				return index < SDL_NUM_SCANCODES ? masked_scancodes[index] : scancode::unknown;
+			}
+
+			if(key >= 0 && key < SDL_Keycode(latin_scancodes.size()))
+				return latin_scancodes[key];
+
+			const auto others = other_scancodes.begin() + other_count;
+			auto found = std::lower_bound(other_scancodes.begin(), others, key,
+				[](auto& entry, SDL_Keycode key) { return entry.first < key; });
+			return found != others && found->first == key
+				? found->second : scancode::unknown;
+		}
+
+		keycode lookup(scancode code) const noexcept
+		{
+			const auto index = to_integer(code);
+			return index < SDL_NUM_SCANCODES ? keycodes[index] : keycode::unknown;
+		}
+	};
+
+	// only touched from the event thread, see codes.h
+	struct keymap_state
+	{
+		keymap_tables tables;
+		bool valid = false;
+
+		const keymap_tables& get() noexcept
+		{
+			if(!valid)
+			{
+				tables.build();
+				valid = true;
+			}
+			return tables;
+		}
+	};
+
+	keymap_state keymap;
+
 	scancode to_scancode(keycode code) noexcept
 	{
-		return static_cast<scancode>(SDL_GetScancodeFromKey(to_integer(code)));
+		return keymap.get().lookup(code);
 	}
 
 	keycode to_keycode(scancode code) noexcept
 	{
-		return static_cast<keycode>(
-			SDL_GetKeyFromScancode(static_cast<SDL_Scancode>(to_integer(code))) );
+		return keymap.get().lookup(code);
+	}
+
+	void to_scancode(const keycode* begin, const keycode* end, scancode* out) noexcept
+	{
+		const auto& tables = keymap.get();
+		std::transform(begin, end, out, [&tables](keycode code) { return tables.lookup(code); });
+	}
+
+	void to_keycode(const scancode* begin, const scancode* end, keycode* out) noexcept
+	{
+		const auto& tables = keymap.get();
+		std::transform(begin, end, out, [&tables](scancode code) { return tables.lookup(code); });
+	}
+
+	void invalidate_keymap() noexcept
+	{
+		keymap.valid = false;
 	}
 
 	bool pressed(scancode code) noexcept
@@ -102,7 +102,7 @@ namespace simple::interactive
 		h = SDLK_h,
 		hash = SDLK_HASH,
 		help = SDLK_HELP,
-		SDLK_HOME,
+		home = SDLK_HOME,
 		i = SDLK_i,
 		insert = SDLK_INSERT,
 		j = SDLK_j,
@@ -492,9 +492,16 @@ namespace simple::interactive
 		z = SDL_SCANCODE_Z,
 	};
 
+	// These go through tables built from the current layout on first use, the tables are rebuilt
+	// on the next use after invalidate_keymap(), which is called automatically when SDL reports a keymap change.
+	// Like the SDL keyboard functions, these are for the thread that pumps events only.
 	scancode to_scancode(keycode) noexcept;
 	keycode to_keycode(scancode) noexcept;
+	void to_scancode(const keycode* begin, const keycode* end, scancode* out) noexcept;
+	void to_keycode(const scancode* begin, const scancode* end, keycode* out) noexcept;
+	void invalidate_keymap() noexcept;
 
+	// as of the last pump, doesn't pump itself
 	bool pressed(scancode) noexcept;
 
 } // namespace simple::interactive
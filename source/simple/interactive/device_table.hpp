@@ -0,0 +1,86 @@
+#ifndef SIMPLE_INTERACTIVE_DEVICE_TABLE_HPP
+#define SIMPLE_INTERACTIVE_DEVICE_TABLE_HPP
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	// Maps device ids to values stored contiguously.
+	// There are only ever a few devices, so a linear search over packed ids,
+	// remembering the last hit, beats hashing, and iterating all values is just walking an array.
+	template <typename Id, typename Value>
+	class device_table
+	{
+		public:
+		using id_type = Id;
+		using value_type = Value;
+
+		Value* find(Id id) noexcept
+		{
+			if(last < ids_.size() && ids_[last] == id)
+				return &values_[last];
+
+			auto found = std::find(ids_.begin(), ids_.end(), id);
+			if(found == ids_.end())
+				return nullptr;
+
+			last = found - ids_.begin();
+			return &values_[last];
+		}
+
+		const Value* find(Id id) const noexcept
+		{
+			auto found = std::find(ids_.begin(), ids_.end(), id);
+			return found == ids_.end() ? nullptr : &values_[found - ids_.begin()];
+		}
+
+		// inserts a copy of the default if the device is new
+		Value& get(Id id, const Value& default_value = Value{})
+		{
+			if(auto value = find(id))
+				return *value;
+
+			ids_.push_back(id);
+			values_.push_back(default_value);
+			last = ids_.size() - 1;
+			return values_.back();
+		}
+
+		Value& operator[](Id id) { return get(id); }
+
+		// gives the value of one device to another, that is not in the table,
+		// false if there's no such device
+		bool rekey(Id from, Id to) noexcept
+		{
+			auto found = std::find(ids_.begin(), ids_.end(), from);
+			if(found == ids_.end())
+				return false;
+			*found = to;
+			return true;
+		}
+
+		void clear() noexcept
+		{
+			ids_.clear();
+			values_.clear();
+			last = 0;
+		}
+
+		std::size_t size() const noexcept { return ids_.size(); }
+		bool empty() const noexcept { return ids_.empty(); }
+
+		const std::vector<Id>& ids() const noexcept { return ids_; }
+		std::vector<Value>& values() noexcept { return values_; }
+		const std::vector<Value>& values() const noexcept { return values_; }
+
+		private:
+		std::vector<Id> ids_;
+		std::vector<Value> values_;
+		std::size_t last = 0;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
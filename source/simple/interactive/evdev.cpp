@@ -0,0 +1,561 @@
+#include "evdev.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include "simple/support/enum.hpp"
+
+using simple::support::to_integer;
+
+namespace simple::interactive
+{
+
+	std::chrono::microseconds evdev_timestamp(const input_event& record) noexcept
+	{
+		return std::chrono::seconds(record.input_event_sec) + std::chrono::microseconds(record.input_event_usec);
+	}
+
+	bool query_evdev_axis(int fd, unsigned code, evdev_axis& axis) noexcept
+	{
+		input_absinfo info;
+		if(ioctl(fd, EVIOCGABS(code), &info) < 0 || info.maximum <= info.minimum)
+			return false;
+		axis = {info.minimum, info.maximum};
+		return true;
+	}
+
+	float evdev_normalized(int value, evdev_axis axis) noexcept
+	{
+		return float(value - axis.minimum) / float(axis.maximum - axis.minimum);
+	}
+
+	bool is_zero(int2 v) noexcept
+	{
+		return v.x() == 0 && v.y() == 0;
+	}
+
+	mouse_button evdev_mouse_button(uint16_t code) noexcept
+	{
+		switch(code)
+		{
+			case BTN_RIGHT: return mouse_button::right;
+			case BTN_MIDDLE: return mouse_button::middle;
+			case BTN_SIDE: return mouse_button::x1;
+			case BTN_EXTRA: return mouse_button::x2;
+			default: return mouse_button::left;
+		}
+	}
+
+	scancode evdev_scancode(uint16_t code) noexcept
+	{
+		switch(code)
+		{
+			case KEY_ESC: return scancode::escape;
+			case KEY_1: return scancode::_1;
+			case KEY_2: return scancode::_2;
+			case KEY_3: return scancode::_3;
+			case KEY_4: return scancode::_4;
+			case KEY_5: return scancode::_5;
+			case KEY_6: return scancode::_6;
+			case KEY_7: return scancode::_7;
+			case KEY_8: return scancode::_8;
+			case KEY_9: return scancode::_9;
+			case KEY_0: return scancode::_0;
+			case KEY_MINUS: return scancode::minus;
+			case KEY_EQUAL: return scancode::equals;
+			case KEY_BACKSPACE: return scancode::backspace;
+			case KEY_TAB: return scancode::tab;
+			case KEY_Q: return scancode::q;
+			case KEY_W: return scancode::w;
+			case KEY_E: return scancode::e;
+			case KEY_R: return scancode::r;
+			case KEY_T: return scancode::t;
+			case KEY_Y: return scancode::y;
+			case KEY_U: return scancode::u;
+			case KEY_I: return scancode::i;
+			case KEY_O: return scancode::o;
+			case KEY_P: return scancode::p;
+			case KEY_LEFTBRACE: return scancode::leftbracket;
+			case KEY_RIGHTBRACE: return scancode::rightbracket;
+			case KEY_ENTER: return scancode::enter;
+			case KEY_LEFTCTRL: return scancode::lctrl;
+			case KEY_A: return scancode::a;
+			case KEY_S: return scancode::s;
+			case KEY_D: return scancode::d;
+			case KEY_F: return scancode::f;
+			case KEY_G: return scancode::g;
+			case KEY_H: return scancode::h;
+			case KEY_J: return scancode::j;
+			case KEY_K: return scancode::k;
+			case KEY_L: return scancode::l;
+			case KEY_SEMICOLON: return scancode::semicolon;
+			case KEY_APOSTROPHE: return scancode::apostrophe;
+			case KEY_GRAVE: return scancode::grave;
+			case KEY_LEFTSHIFT: return scancode::lshift;
+			case KEY_BACKSLASH: return scancode::backslash;
+			case KEY_Z: return scancode::z;
+			case KEY_X: return scancode::x;
+			case KEY_C: return scancode::c;
+			case KEY_V: return scancode::v;
+			case KEY_B: return scancode::b;
+			case KEY_N: return scancode::n;
+			case KEY_M: return scancode::m;
+			case KEY_COMMA: return scancode::comma;
+			case KEY_DOT: return scancode::period;
+			case KEY_SLASH: return scancode::slash;
+			case KEY_RIGHTSHIFT: return scancode::rshift;
+			case KEY_KPASTERISK: return scancode::kp_multiply;
+			case KEY_LEFTALT: return scancode::lalt;
+			case KEY_SPACE: return scancode::space;
+			case KEY_CAPSLOCK: return scancode::capslock;
+			case KEY_F1: return scancode::f1;
+			case KEY_F2: return scancode::f2;
+			case KEY_F3: return scancode::f3;
+			case KEY_F4: return scancode::f4;
+			case KEY_F5: return scancode::f5;
+			case KEY_F6: return scancode::f6;
+			case KEY_F7: return scancode::f7;
+			case KEY_F8: return scancode::f8;
+			case KEY_F9: return scancode::f9;
+			case KEY_F10: return scancode::f10;
+			case KEY_NUMLOCK: return scancode::numlockclear;
+			case KEY_SCROLLLOCK: return scancode::scrolllock;
+			case KEY_KP7: return scancode::kp_7;
+			case KEY_KP8: return scancode::kp_8;
+			case KEY_KP9: return scancode::kp_9;
+			case KEY_KPMINUS: return scancode::kp_minus;
+			case KEY_KP4: return scancode::kp_4;
+			case KEY_KP5: return scancode::kp_5;
+			case KEY_KP6: return scancode::kp_6;
+			case KEY_KPPLUS: return scancode::kp_plus;
+			case KEY_KP1: return scancode::kp_1;
+			case KEY_KP2: return scancode::kp_2;
+			case KEY_KP3: return scancode::kp_3;
+			case KEY_KP0: return scancode::kp_0;
+			case KEY_KPDOT: return scancode::kp_period;
+			case KEY_ZENKAKUHANKAKU: return scancode::lang5;
+			case KEY_102ND: return scancode::nonusbackslash;
+			case KEY_F11: return scancode::f11;
+			case KEY_F12: return scancode::f12;
+			case KEY_RO: return scancode::international1;
+			case KEY_KATAKANA: return scancode::lang3;
+			case KEY_HIRAGANA: return scancode::lang4;
+			case KEY_HENKAN: return scancode::international4;
+			case KEY_KATAKANAHIRAGANA: return scancode::international2;
+			case KEY_MUHENKAN: return scancode::international5;
+			case KEY_KPENTER: return scancode::kp_enter;
+			case KEY_RIGHTCTRL: return scancode::rctrl;
+			case KEY_KPSLASH: return scancode::kp_divide;
+			case KEY_SYSRQ: return scancode::printscreen;
+			case KEY_RIGHTALT: return scancode::ralt;
+			case KEY_HOME: return scancode::home;
+			case KEY_UP: return scancode::up;
+			case KEY_PAGEUP: return scancode::pageup;
+			case KEY_LEFT: return scancode::left;
+			case KEY_RIGHT: return scancode::right;
+			case KEY_END: return scancode::end;
+			case KEY_DOWN: return scancode::down;
+			case KEY_PAGEDOWN: return scancode::pagedown;
+			case KEY_INSERT: return scancode::insert;
+			case KEY_DELETE: return scancode::del;
+			case KEY_MUTE: return scancode::mute;
+			case KEY_VOLUMEDOWN: return scancode::volumedown;
+			case KEY_VOLUMEUP: return scancode::volumeup;
+			case KEY_POWER: return scancode::power;
+			case KEY_KPEQUAL: return scancode::kp_equals;
+			case KEY_KPPLUSMINUS: return scancode::kp_plusminus;
+			case KEY_PAUSE: return scancode::pause;
+			case KEY_KPCOMMA: return scancode::kp_comma;
+			case KEY_HANGEUL: return scancode::lang1;
+			case KEY_HANJA: return scancode::lang2;
+			case KEY_YEN: return scancode::international3;
+			case KEY_LEFTMETA: return scancode::lgui;
+			case KEY_RIGHTMETA: return scancode::rgui;
+			case KEY_COMPOSE: return scancode::application;
+			case KEY_STOP: return scancode::stop;
+			case KEY_AGAIN: return scancode::again;
+			case KEY_UNDO: return scancode::undo;
+			case KEY_COPY: return scancode::copy;
+			case KEY_PASTE: return scancode::paste;
+			case KEY_FIND: return scancode::find;
+			case KEY_CUT: return scancode::cut;
+			case KEY_HELP: return scancode::help;
+			case KEY_MENU: return scancode::menu;
+			case KEY_CALC: return scancode::calculator;
+			case KEY_SLEEP: return scancode::sleep;
+			case KEY_WWW: return scancode::www;
+			case KEY_MAIL: return scancode::mail;
+			case KEY_BOOKMARKS: return scancode::ac_bookmarks;
+			case KEY_COMPUTER: return scancode::computer;
+			case KEY_BACK: return scancode::ac_back;
+			case KEY_FORWARD: return scancode::ac_forward;
+			case KEY_EJECTCD: return scancode::eject;
+			case KEY_NEXTSONG: return scancode::audionext;
+			case KEY_PLAYPAUSE: return scancode::audioplay;
+			case KEY_PREVIOUSSONG: return scancode::audioprev;
+			case KEY_STOPCD: return scancode::audiostop;
+			case KEY_HOMEPAGE: return scancode::ac_home;
+			case KEY_REFRESH: return scancode::ac_refresh;
+			case KEY_KPLEFTPAREN: return scancode::kp_leftparen;
+			case KEY_KPRIGHTPAREN: return scancode::kp_rightparen;
+			case KEY_F13: return scancode::f13;
+			case KEY_F14: return scancode::f14;
+			case KEY_F15: return scancode::f15;
+			case KEY_F16: return scancode::f16;
+			case KEY_F17: return scancode::f17;
+			case KEY_F18: return scancode::f18;
+			case KEY_F19: return scancode::f19;
+			case KEY_F20: return scancode::f20;
+			case KEY_F21: return scancode::f21;
+			case KEY_F22: return scancode::f22;
+			case KEY_F23: return scancode::f23;
+			case KEY_F24: return scancode::f24;
+			case KEY_SEARCH: return scancode::ac_search;
+			case KEY_CANCEL: return scancode::cancel;
+			case KEY_MEDIA: return scancode::mediaselect;
+			case KEY_BRIGHTNESSDOWN: return scancode::brightnessdown;
+			case KEY_BRIGHTNESSUP: return scancode::brightnessup;
+			case KEY_SWITCHVIDEOMODE: return scancode::displayswitch;
+			case KEY_KBDILLUMTOGGLE: return scancode::kbdillumtoggle;
+			case KEY_KBDILLUMDOWN: return scancode::kbdillumdown;
+			case KEY_KBDILLUMUP: return scancode::kbdillumup;
+			default: return scancode::unknown;
+		}
+	}
+
+	evdev_source::evdev_source(int fd, uint32_t device_id) noexcept :
+		fd_(fd),
+		device_id_(device_id)
+	{
+		// these fail harmlessly if the descriptor is not a device node
+		int clock = CLOCK_MONOTONIC;
+		ioctl(fd_, EVIOCSCLOCKID, &clock);
+		query_evdev_axis(fd_, ABS_MT_POSITION_X, x_range) || query_evdev_axis(fd_, ABS_X, x_range);
+		query_evdev_axis(fd_, ABS_MT_POSITION_Y, y_range) || query_evdev_axis(fd_, ABS_Y, y_range);
+		query_evdev_axis(fd_, ABS_MT_PRESSURE, pressure_range_) || query_evdev_axis(fd_, ABS_PRESSURE, pressure_range_);
+	}
+
+	int evdev_source::fd() const noexcept
+	{
+		return fd_;
+	}
+
+	uint32_t evdev_source::device_id() const noexcept
+	{
+		return device_id_;
+	}
+
+	void evdev_source::touch_range(evdev_axis x, evdev_axis y) noexcept
+	{
+		x_range = x;
+		y_range = y;
+	}
+
+	void evdev_source::pressure_range(evdev_axis pressure) noexcept
+	{
+		pressure_range_ = pressure;
+	}
+
+	ssize_t evdev_source::fill() noexcept
+	{
+		// keep the partial record, if any, pipes don't care about record boundaries
+		const std::size_t leftover = buffer_end - buffer_begin;
+		std::memmove(buffer.data(), buffer.data() + buffer_begin, leftover);
+		buffer_begin = 0;
+		buffer_end = leftover;
+
+		ssize_t result;
+		do result = read(fd_, buffer.data() + buffer_end, buffer.size() - buffer_end);
+		while(result < 0 && errno == EINTR);
+
+		if(result > 0)
+			buffer_end += result;
+		return result;
+	}
+
+	std::optional<event> evdev_source::next_event() noexcept
+	{
+		while(pending_begin == pending.size())
+		{
+			pending.clear();
+			pending_begin = 0;
+
+			if(buffer_end - buffer_begin < sizeof(input_event) && fill() <= 0)
+				return std::nullopt;
+
+			while(pending.empty() && buffer_end - buffer_begin >= sizeof(input_event))
+			{
+				input_event record;
+				std::memcpy(&record, buffer.data() + buffer_begin, sizeof(record));
+				buffer_begin += sizeof(record);
+				translate(record);
+			}
+		}
+		return pending[pending_begin++];
+	}
+
+	void evdev_source::translate(const input_event& record) noexcept
+	{
+		if(record.type == EV_SYN)
+		{
+			switch(record.code)
+			{
+				case SYN_DROPPED:
+					dropped = true;
+				break;
+
+				case SYN_REPORT:
+					if(dropped)
+					{
+						// kernel buffer overrun, the frame is incomplete, so throw it away
+						dropped = false;
+						relative_motion = int2::zero();
+						wheel_motion = int2::zero();
+						for(auto& slot : slots)
+							slot.changed = slot.began = slot.ended = false;
+					}
+					else
+						report(evdev_timestamp(record));
+				break;
+			}
+			return;
+		}
+
+		if(dropped)
+			return;
+
+		switch(record.type)
+		{
+			case EV_KEY:
+				translate_key(record);
+			break;
+
+			case EV_REL: switch(record.code)
+			{
+				case REL_X: relative_motion.x() += record.value; break;
+				case REL_Y: relative_motion.y() += record.value; break;
+				case REL_HWHEEL: wheel_motion.x() += record.value; break;
+				case REL_WHEEL: wheel_motion.y() += record.value; break;
+			}
+			break;
+
+			case EV_ABS:
+				translate_abs(record);
+			break;
+		}
+	}
+
+	void evdev_source::translate_key(const input_event& record) noexcept
+	{
+		const auto timestamp = evdev_timestamp(record);
+		switch(record.code)
+		{
+			case BTN_LEFT:
+			case BTN_RIGHT:
+			case BTN_MIDDLE:
+			case BTN_SIDE:
+			case BTN_EXTRA:
+			{
+				if(record.value == 2) // autorepeat
+					break;
+
+				// motion reported in the same frame happened before the click, as far as we can tell
+				flush_motion(timestamp);
+
+				const auto button = evdev_mouse_button(record.code);
+				const auto mask = to_integer(to_mask(button));
+				if(record.value)
+				{
+					buttons = static_cast<mouse_button_mask>(to_integer(buttons) | mask);
+					pending.push_back(mouse_down
+					{
+						make_event_data(timestamp), 0, device_id_, mouse_position,
+						button, keystate::pressed, 1
+					});
+				}
+				else
+				{
+					buttons = static_cast<mouse_button_mask>(to_integer(buttons) & ~mask);
+					pending.push_back(mouse_up
+					{
+						make_event_data(timestamp), 0, device_id_, mouse_position,
+						button, keystate::released, 1
+					});
+				}
+			}
+			break;
+
+			case BTN_TOUCH:
+				if(!multitouch)
+				{
+					auto& slot = slots[0];
+					if(record.value)
+					{
+						slot.tracking_id = 0;
+						slot.began = true;
+					}
+					else if(slot.tracking_id >= 0)
+						slot.ended = true;
+					slot.changed = true;
+				}
+			break;
+
+			default:
+				if(record.code < BTN_MISC)
+				{
+					const auto code = evdev_scancode(record.code);
+					const key_data data
+					{
+						make_event_data(timestamp), 0,
+						to_keycode(code), code,
+						record.value ? keystate::pressed : keystate::released,
+						uint8_t(record.value == 2)
+					};
+					if(record.value)
+						pending.push_back(key_pressed{{data}});
+					else
+						pending.push_back(key_released{{data}});
+				}
+		}
+	}
+
+	auto evdev_source::active_slot() noexcept -> slot*
+	{
+		return current_slot < slots.size() ? &slots[current_slot] : nullptr;
+	}
+
+	void evdev_source::translate_abs(const input_event& record) noexcept
+	{
+		switch(record.code)
+		{
+			case ABS_MT_SLOT:
+				multitouch = true;
+				current_slot = record.value >= 0 ? record.value : slots.size();
+			break;
+
+			case ABS_MT_TRACKING_ID:
+				multitouch = true;
+				if(auto slot = active_slot())
+				{
+					if(record.value < 0)
+						slot->ended = slot->tracking_id >= 0;
+					else
+					{
+						slot->tracking_id = record.value;
+						slot->began = true;
+					}
+					slot->changed = true;
+				}
+			break;
+
+			case ABS_MT_POSITION_X:
+			case ABS_MT_POSITION_Y:
+			case ABS_MT_PRESSURE:
+				multitouch = true;
+				if(auto slot = active_slot())
+				{
+					if(record.code == ABS_MT_POSITION_X)
+						slot->position.x() = record.value;
+					else if(record.code == ABS_MT_POSITION_Y)
+						slot->position.y() = record.value;
+					else
+						slot->pressure = record.value;
+					slot->changed = true;
+				}
+			break;
+
+			// single touch devices, multitouch ones report these as well, for compatibility
+			case ABS_X:
+			case ABS_Y:
+			case ABS_PRESSURE:
+				if(!multitouch)
+				{
+					auto& slot = slots[0];
+					if(record.code == ABS_X)
+						slot.position.x() = record.value;
+					else if(record.code == ABS_Y)
+						slot.position.y() = record.value;
+					else
+						slot.pressure = record.value;
+					slot.changed = true;
+				}
+			break;
+		}
+	}
+
+	void evdev_source::flush_motion(std::chrono::microseconds timestamp) noexcept
+	{
+		if(is_zero(relative_motion))
+			return;
+
+		mouse_position += relative_motion;
+		pending.push_back(mouse_motion
+		{
+			make_event_data(timestamp), 0, device_id_, mouse_position,
+			relative_motion, buttons
+		});
+		relative_motion = int2::zero();
+	}
+
+	pointer_data evdev_source::make_pointer_data(std::chrono::microseconds timestamp, int64_t pointer_id, const slot& slot) const noexcept
+	{
+		return pointer_data
+		{
+			make_event_data(timestamp),
+			device_id_,
+			pointer_id,
+			{evdev_normalized(slot.position.x(), x_range), evdev_normalized(slot.position.y(), y_range)},
+			{
+				float(slot.position.x() - slot.last_position.x()) / float(x_range.maximum - x_range.minimum),
+				float(slot.position.y() - slot.last_position.y()) / float(y_range.maximum - y_range.minimum)
+			},
+			evdev_normalized(slot.pressure, pressure_range_)
+		};
+	}
+
+	void evdev_source::report(std::chrono::microseconds timestamp) noexcept
+	{
+		flush_motion(timestamp);
+
+		if(!is_zero(wheel_motion))
+		{
+			pending.push_back(mouse_wheel
+			{
+				make_event_data(timestamp), 0, device_id_, wheel_motion,
+#if SDL_VERSION_ATLEAST(2,0,4)
+				wheel_direction::normal
+#endif
+			});
+			wheel_motion = int2::zero();
+		}
+
+		for(auto& slot : slots)
+		{
+			if(!slot.changed)
+				continue;
+
+			if(slot.began)
+			{
+				slot.last_position = slot.position;
+				pending.push_back(pointer_down{make_pointer_data(timestamp, slot.tracking_id, slot)});
+			}
+			else if(!slot.ended && slot.tracking_id >= 0)
+				pending.push_back(pointer_motion{make_pointer_data(timestamp, slot.tracking_id, slot)});
+
+			if(slot.ended)
+			{
+				pending.push_back(pointer_up{make_pointer_data(timestamp, slot.tracking_id, slot)});
+				slot.tracking_id = -1;
+			}
+
+			slot.last_position = slot.position;
+			slot.changed = slot.began = slot.ended = false;
+		}
+	}
+
+} // namespace simple::interactive
+
+#endif
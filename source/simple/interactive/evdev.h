@@ -0,0 +1,100 @@
+#ifndef SIMPLE_INTERACTIVE_EVDEV_H
+#define SIMPLE_INTERACTIVE_EVDEV_H
+#include "event.h"
+
+#if defined(__linux__)
+#include <array>
+#include <vector>
+#include <sys/types.h>
+#include <linux/input.h>
+
+namespace simple::interactive
+{
+
+	struct evdev_axis
+	{
+		int minimum;
+		int maximum;
+	};
+
+	// Not in interactive.hpp, since linux/input.h brings a lot of macros (KEY_*, BTN_* and such) along.
+	//
+	// Reads raw linux input_event records from a file descriptor and translates them to events.
+	// The descriptor can be an evdev device node, or anything else that produces the same byte stream,
+	// like a pipe or a file with recorded input. Timestamps are the ones provided by the kernel,
+	// precise_timestamp to the microsecond (monotonic clock for device nodes, whatever was recorded otherwise).
+	// Mouse events carry the device_id given here and no window id,
+	// mouse positions are accumulated from relative motion starting at zero.
+	class evdev_source
+	{
+		public:
+		// does not take ownership of the file descriptor
+		explicit evdev_source(int fd, uint32_t device_id = 0) noexcept;
+
+		std::optional<event> next_event() noexcept;
+
+		// reads as many records as fit in the buffer with a single read() call,
+		// returns the result of the call
+		ssize_t fill() noexcept;
+
+		// readable when there is input, can go in epoll along with an input_readiness
+		int fd() const noexcept;
+		uint32_t device_id() const noexcept;
+
+		// ranges used to normalize touch positions and pressure,
+		// queried from the device when possible, otherwise default to [0,1]
+		void touch_range(evdev_axis x, evdev_axis y) noexcept;
+		void pressure_range(evdev_axis pressure) noexcept;
+
+		private:
+		static constexpr std::size_t buffer_records = 64;
+		static constexpr std::size_t max_slots = 16;
+
+		struct slot
+		{
+			int32_t tracking_id = -1;
+			int2 position{};
+			int2 last_position{};
+			int pressure = 0;
+			bool changed = false;
+			bool began = false;
+			bool ended = false;
+		};
+
+		slot* active_slot() noexcept;
+		void translate(const input_event&) noexcept;
+		void translate_key(const input_event&) noexcept;
+		void translate_abs(const input_event&) noexcept;
+		void report(std::chrono::microseconds) noexcept;
+		void flush_motion(std::chrono::microseconds) noexcept;
+		pointer_data make_pointer_data(std::chrono::microseconds, int64_t pointer_id, const slot&) const noexcept;
+
+		int fd_;
+		uint32_t device_id_;
+
+		alignas(input_event) std::array<unsigned char, buffer_records * sizeof(input_event)> buffer;
+		std::size_t buffer_begin = 0;
+		std::size_t buffer_end = 0;
+
+		std::vector<event> pending;
+		std::size_t pending_begin = 0;
+
+		bool dropped = false;
+		int2 mouse_position{};
+		int2 relative_motion{};
+		int2 wheel_motion{};
+		mouse_button_mask buttons = mouse_button_mask::none;
+
+		bool multitouch = false;
+		std::size_t current_slot = 0;
+		std::array<slot, max_slots> slots{};
+		evdev_axis x_range{0,1};
+		evdev_axis y_range{0,1};
+		evdev_axis pressure_range_{0,1};
+	};
+
+} // namespace simple::interactive
+
+#endif
+
+#endif /* end of include guard */
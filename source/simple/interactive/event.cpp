@@ -1,4 +1,5 @@
 #include "event.h"
+#include "queue.h"
 #include "simple/sdlcore/utils.hpp"
 
 using simple::geom::vector;
@@ -22,7 +23,7 @@ namespace simple::interactive
 	{
 		return WindowEvent
 		{
-			std::chrono::milliseconds(event.window.timestamp),
+			make_event_data(std::chrono::milliseconds(event.window.timestamp)),
 			event.window.windowID,
 		};
 	}
@@ -32,176 +33,211 @@ namespace simple::interactive
 	{
 		return WindowEvent
 		{
-			std::chrono::milliseconds(event.window.timestamp),
+			make_event_data(std::chrono::milliseconds(event.window.timestamp)),
 			event.window.windowID,
 			vector{event.window.data1, event.window.data2}
 		};
 	}
 
-	std::optional<event> next_event() noexcept
+	std::optional<event> translate(const SDL_Event& event) noexcept
 	{
-		SDL_Event event;
-		while(SDL_PollEvent(&event))
+		switch(event.type)
 		{
-			switch(event.type)
-			{
-				case SDL_KEYDOWN:
-					return key_pressed
-					{
-						std::chrono::milliseconds(event.key.timestamp),
-						event.key.windowID,
-						static_cast<keycode>(event.key.keysym.sym),
-						static_cast<scancode>(event.key.keysym.scancode),
-						static_cast<keystate>(event.key.state),
-						event.key.repeat
-					};
-				case SDL_KEYUP:
-					return key_released
-					{
-						std::chrono::milliseconds(event.key.timestamp),
-						event.key.windowID,
-						static_cast<keycode>(event.key.keysym.sym),
-						static_cast<scancode>(event.key.keysym.scancode),
-						static_cast<keystate>(event.key.state),
-						event.key.repeat
-					};
-				case SDL_MOUSEBUTTONDOWN:
-					return mouse_down
-					{
-						std::chrono::milliseconds(event.button.timestamp),
-						event.button.windowID,
-						event.button.which,
-						vector{event.button.x, event.button.y},
-						static_cast<mouse_button>(event.button.button),
-						static_cast<keystate>(event.button.state),
-						event.button.clicks
-					};
-				case SDL_MOUSEBUTTONUP:
-					return mouse_up
-					{
-						std::chrono::milliseconds(event.button.timestamp),
-						event.button.windowID,
-						event.button.which,
-						vector{event.button.x, event.button.y},
-						static_cast<mouse_button>(event.button.button),
-						static_cast<keystate>(event.button.state),
+			case SDL_KEYDOWN:
+				return key_pressed
+				{
+					make_event_data(std::chrono::milliseconds(event.key.timestamp)),
+					event.key.windowID,
+					static_cast<keycode>(event.key.keysym.sym),
+					static_cast<scancode>(event.key.keysym.scancode),
+					static_cast<keystate>(event.key.state),
+					event.key.repeat
+				};
+			case SDL_KEYUP:
+				return key_released
+				{
+					make_event_data(std::chrono::milliseconds(event.key.timestamp)),
+					event.key.windowID,
+					static_cast<keycode>(event.key.keysym.sym),
+					static_cast<scancode>(event.key.keysym.scancode),
+					static_cast<keystate>(event.key.state),
+					event.key.repeat
+				};
+			case SDL_MOUSEBUTTONDOWN:
+				return mouse_down
+				{
+					make_event_data(std::chrono::milliseconds(event.button.timestamp)),
+					event.button.windowID,
+					event.button.which,
+					vector{event.button.x, event.button.y},
+					static_cast<mouse_button>(event.button.button),
+					static_cast<keystate>(event.button.state),
+					event.button.clicks
+				};
+			case SDL_MOUSEBUTTONUP:
+				return mouse_up
+				{
+					make_event_data(std::chrono::milliseconds(event.button.timestamp)),
+					event.button.windowID,
+					event.button.which,
+					vector{event.button.x, event.button.y},
+					static_cast<mouse_button>(event.button.button),
+					static_cast<keystate>(event.button.state),
 #if SDL_VERSION_ATLEAST(2,0,2)
-						event.button.clicks
+					event.button.clicks
 #endif
-					};
-				case SDL_MOUSEMOTION:
-					return mouse_motion
-					{
-						std::chrono::milliseconds(event.motion.timestamp),
-						event.motion.windowID,
-						event.motion.which,
-						vector{event.motion.x, event.motion.y},
-						vector{event.motion.xrel, event.motion.yrel},
-						static_cast<mouse_button_mask>(event.motion.state),
-					};
-				case SDL_MOUSEWHEEL:
-					return mouse_wheel
-					{
-						std::chrono::milliseconds(event.wheel.timestamp),
-						event.wheel.windowID,
-						event.wheel.which,
-						vector{event.wheel.x, event.wheel.y},
+				};
+			case SDL_MOUSEMOTION:
+				return mouse_motion
+				{
+					make_event_data(std::chrono::milliseconds(event.motion.timestamp)),
+					event.motion.windowID,
+					event.motion.which,
+					vector{event.motion.x, event.motion.y},
+					vector{event.motion.xrel, event.motion.yrel},
+					static_cast<mouse_button_mask>(event.motion.state),
+				};
+			case SDL_MOUSEWHEEL:
+				return mouse_wheel
+				{
+					make_event_data(std::chrono::milliseconds(event.wheel.timestamp)),
+					event.wheel.windowID,
+					event.wheel.which,
+					vector{event.wheel.x, event.wheel.y},
 #if SDL_VERSION_ATLEAST(2,0,4)
-						static_cast<wheel_direction>(event.wheel.direction),
+					static_cast<wheel_direction>(event.wheel.direction),
 #endif
-					};
-				case SDL_TEXTINPUT:
-					return text_input
-					{
-						std::chrono::milliseconds(event.text.timestamp),
-						event.text.windowID,
-						to_array(event.text.text)
-					};
-				case SDL_TEXTEDITING:
-					return text_edit
-					{
-						std::chrono::milliseconds(event.edit.timestamp),
-						event.edit.windowID,
-						to_array(event.edit.text),
-						{event.edit.start, event.edit.start + event.edit.length}
-					};
-				case SDL_FINGERMOTION:
-					return pointer_motion
-					{
-						std::chrono::milliseconds(event.tfinger.timestamp),
-						event.tfinger.touchId,
-						event.tfinger.fingerId,
-						{event.tfinger.x, event.tfinger.y},
-						{event.tfinger.dx, event.tfinger.dy},
-						event.tfinger.pressure
-					};
-				case SDL_FINGERDOWN:
-					return pointer_down
-					{
-						std::chrono::milliseconds(event.tfinger.timestamp),
-						event.tfinger.touchId,
-						event.tfinger.fingerId,
-						{event.tfinger.x, event.tfinger.y},
-						{event.tfinger.dx, event.tfinger.dy},
-						event.tfinger.pressure
-					};
-				case SDL_FINGERUP:
-					return pointer_up
-					{
-						std::chrono::milliseconds(event.tfinger.timestamp),
-						event.tfinger.touchId,
-						event.tfinger.fingerId,
-						{event.tfinger.x, event.tfinger.y},
-						{event.tfinger.dx, event.tfinger.dy},
-						event.tfinger.pressure
-					};
-
-				case SDL_WINDOWEVENT: switch(event.window.event)
+				};
+			case SDL_TEXTINPUT:
+				return text_input
+				{
+					make_event_data(std::chrono::milliseconds(event.text.timestamp)),
+					event.text.windowID,
+					to_array(event.text.text)
+				};
+			case SDL_TEXTEDITING:
+				return text_edit
+				{
+					make_event_data(std::chrono::milliseconds(event.edit.timestamp)),
+					event.edit.windowID,
+					to_array(event.edit.text),
+					{event.edit.start, event.edit.start + event.edit.length}
+				};
+			case SDL_FINGERMOTION:
+				return pointer_motion
+				{
+					make_event_data(std::chrono::milliseconds(event.tfinger.timestamp)),
+					event.tfinger.touchId,
+					event.tfinger.fingerId,
+					{event.tfinger.x, event.tfinger.y},
+					{event.tfinger.dx, event.tfinger.dy},
+					event.tfinger.pressure
+				};
+			case SDL_FINGERDOWN:
+				return pointer_down
 				{
-					case SDL_WINDOWEVENT_SHOWN:
-						return make_window_event<window_shown>(event);
-					case SDL_WINDOWEVENT_HIDDEN:
-						return make_window_event<window_hidden>(event);
-					case SDL_WINDOWEVENT_EXPOSED:
-						return make_window_event<window_exposed>(event);
-					case SDL_WINDOWEVENT_MOVED:
-						return make_window_vector_event<window_moved>(event);
-					case SDL_WINDOWEVENT_RESIZED:
-						return make_window_vector_event<window_resized>(event);
-					case SDL_WINDOWEVENT_SIZE_CHANGED:
-						return make_window_vector_event<window_size_changed>(event);
-					case SDL_WINDOWEVENT_MINIMIZED:
-						return make_window_event<window_minimized>(event);
-					case SDL_WINDOWEVENT_MAXIMIZED:
-						return make_window_event<window_maximized>(event);
-					case SDL_WINDOWEVENT_RESTORED:
-						return make_window_event<window_restored>(event);
-					case SDL_WINDOWEVENT_ENTER:
-						return make_window_event<window_entered>(event);
-					case SDL_WINDOWEVENT_LEAVE:
-						return make_window_event<window_left>(event);
-					case SDL_WINDOWEVENT_FOCUS_GAINED:
-						return make_window_event<window_focus_gained>(event);
-					case SDL_WINDOWEVENT_FOCUS_LOST:
-						return make_window_event<window_focus_lost>(event);
-					case SDL_WINDOWEVENT_CLOSE:
-						return make_window_event<window_closed>(event);
+					make_event_data(std::chrono::milliseconds(event.tfinger.timestamp)),
+					event.tfinger.touchId,
+					event.tfinger.fingerId,
+					{event.tfinger.x, event.tfinger.y},
+					{event.tfinger.dx, event.tfinger.dy},
+					event.tfinger.pressure
+				};
+			case SDL_FINGERUP:
+				return pointer_up
+				{
+					make_event_data(std::chrono::milliseconds(event.tfinger.timestamp)),
+					event.tfinger.touchId,
+					event.tfinger.fingerId,
+					{event.tfinger.x, event.tfinger.y},
+					{event.tfinger.dx, event.tfinger.dy},
+					event.tfinger.pressure
+				};
+
+			case SDL_WINDOWEVENT: switch(event.window.event)
+			{
+				case SDL_WINDOWEVENT_SHOWN:
+					return make_window_event<window_shown>(event);
+				case SDL_WINDOWEVENT_HIDDEN:
+					return make_window_event<window_hidden>(event);
+				case SDL_WINDOWEVENT_EXPOSED:
+					return make_window_event<window_exposed>(event);
+				case SDL_WINDOWEVENT_MOVED:
+					return make_window_vector_event<window_moved>(event);
+				case SDL_WINDOWEVENT_RESIZED:
+					return make_window_vector_event<window_resized>(event);
+				case SDL_WINDOWEVENT_SIZE_CHANGED:
+					return make_window_vector_event<window_size_changed>(event);
+				case SDL_WINDOWEVENT_MINIMIZED:
+					return make_window_event<window_minimized>(event);
+				case SDL_WINDOWEVENT_MAXIMIZED:
+					return make_window_event<window_maximized>(event);
+				case SDL_WINDOWEVENT_RESTORED:
+					return make_window_event<window_restored>(event);
+				case SDL_WINDOWEVENT_ENTER:
+					return make_window_event<window_entered>(event);
+				case SDL_WINDOWEVENT_LEAVE:
+					return make_window_event<window_left>(event);
+				case SDL_WINDOWEVENT_FOCUS_GAINED:
+					return make_window_event<window_focus_gained>(event);
+				case SDL_WINDOWEVENT_FOCUS_LOST:
+					return make_window_event<window_focus_lost>(event);
+				case SDL_WINDOWEVENT_CLOSE:
+					return make_window_event<window_closed>(event);
 #if SDL_VERSION_ATLEAST(2, 0, 5)
-					case SDL_WINDOWEVENT_TAKE_FOCUS:
-						return make_window_event<window_take_focus>(event);
-					case SDL_WINDOWEVENT_HIT_TEST:
-						return make_window_event<window_hit_test>(event);
+				case SDL_WINDOWEVENT_TAKE_FOCUS:
+					return make_window_event<window_take_focus>(event);
+				case SDL_WINDOWEVENT_HIT_TEST:
+					return make_window_event<window_hit_test>(event);
 #endif
-				}
-				break;
-
-				case SDL_QUIT:
-					return quit_request{};
 			}
+			break;
+
+			case SDL_QUIT:
+				return quit_request{make_event_data(std::chrono::milliseconds(event.quit.timestamp))};
 		}
 		return std::nullopt;
 	}
 
+	std::chrono::milliseconds timestamp(const event& e) noexcept
+	{
+		return std::visit([](auto&& e) { return e.data.timestamp; }, e);
+	}
+
+	std::chrono::microseconds precise_timestamp(const event& e) noexcept
+	{
+		return std::visit([](auto&& e) { return e.data.precise_timestamp; }, e);
+	}
+
+	uint32_t window_id(const event& e) noexcept
+	{
+		return std::visit([](auto&& e) -> uint32_t
+		{
+			if constexpr (std::is_base_of_v<window_event_data, std::decay_t<decltype(e.data)>>)
+				return e.data.window_id;
+			else
+				return 0;
+		}, e);
+	}
+
+	std::optional<event> next_event() noexcept
+	{
+		SDL_Event event;
+		while(poll_event(event))
+			if(auto translated = translate(event))
+				return translated;
+		return std::nullopt;
+	}
+
+	std::optional<event> next_event(no_pump_t) noexcept
+	{
+		SDL_Event event;
+		while(poll_event(event, no_pump))
+			if(auto translated = translate(event))
+				return translated;
+		return std::nullopt;
+	}
+
 #if SDL_VERSION_ATLEAST(2,0,4)
 	int2 mouse_wheel::motion() const noexcept
 	{
@@ -301,6 +337,16 @@ namespace simple::interactive
 		sdlcore::utils::throw_error(SDL_CaptureMouse(SDL_bool(enable)));
 	}
 
+	bool mouse_capture(bool enable, no_pump_t) noexcept
+	{
+		return !sdlcore::utils::check_error(SDL_CaptureMouse(SDL_bool(enable)));
+	}
+
+	void require_mouse_capture(bool enable, no_pump_t)
+	{
+		sdlcore::utils::throw_error(SDL_CaptureMouse(SDL_bool(enable)));
+	}
+
 #endif
 
 } // namespace simple::interactive
@@ -1,6 +1,7 @@
 #ifndef SIMPLE_INTERACTIVE_EVENT_H
 #define SIMPLE_INTERACTIVE_EVENT_H
 #include "codes.h"
+#include "queue.h"
 #include <chrono>
 #include <variant>
 #include <optional>
@@ -43,6 +44,11 @@ namespace simple::interactive
 		x1 = SDL_BUTTON_X1MASK,
 		x2 = SDL_BUTTON_X2MASK
 	};
+
+	constexpr mouse_button_mask to_mask(mouse_button button) noexcept
+	{
+		return static_cast<mouse_button_mask>(SDL_BUTTON(static_cast<uint8_t>(button)));
+	}
 	using ::operator |;
 	using ::operator &;
 	using ::operator &&;
@@ -51,9 +57,19 @@ namespace simple::interactive
 
 	struct event_data
 	{
+		// SDL's own unit
 		std::chrono::milliseconds timestamp;
+		// The same time in microseconds, more precise when the source is (evdev),
+		// otherwise just the milliseconds converted. The library works with this one.
+		std::chrono::microseconds precise_timestamp;
 	};
 
+	// both timestamps from the precise one
+	inline event_data make_event_data(std::chrono::microseconds time) noexcept
+	{
+		return {std::chrono::duration_cast<std::chrono::milliseconds>(time), time};
+	}
+
 	struct window_event_data : public event_data
 	{
 		uint32_t window_id;
@@ -227,7 +243,42 @@ namespace simple::interactive
 #endif
 	>;
 
+	template <typename Event, typename... Events>
+	constexpr std::size_t index_of(std::variant<Events...>*) noexcept
+	{
+		std::size_t index = 0;
+		(void)((std::is_same_v<Event, Events> || (++index, false)) || ...);
+		return index;
+	}
+
+	// position of the event type in the event variant
+	template <typename Event>
+	constexpr std::size_t event_index = index_of<Event>(static_cast<event*>(nullptr));
+
+	std::chrono::milliseconds timestamp(const event&) noexcept;
+	std::chrono::microseconds precise_timestamp(const event&) noexcept;
+	// zero for events not associated with a window
+	uint32_t window_id(const event&) noexcept;
+
+	std::optional<event> translate(const SDL_Event&) noexcept;
 	std::optional<event> next_event() noexcept;
+	std::optional<event> next_event(no_pump_t) noexcept;
+
+	// appends all pending events to the container, returns the number of events appended,
+	// pass no_pump to only take what the last pump() gathered
+	template <typename Container, typename... Pump>
+	std::size_t drain_events(Container& events, Pump... pump)
+	{
+		grow_spill();
+		begin_drain();
+		std::size_t count = 0;
+		while(auto e = next_event(pump...))
+		{
+			events.push_back(std::move(*e));
+			++count;
+		}
+		return count;
+	}
 
 	// better to use expected<bool, error>
 	bool relative_mouse_mode() noexcept;
@@ -238,6 +289,9 @@ namespace simple::interactive
 	// better to use expected<bool, error>
 	bool mouse_capture(bool enable) noexcept;
 	void require_mouse_capture(bool enable);
+	// the mouse state must be up to date, as of a pump() this frame
+	bool mouse_capture(bool enable, no_pump_t) noexcept;
+	void require_mouse_capture(bool enable, no_pump_t);
 #endif
 
 } // namespace simple::interactive
@@ -0,0 +1,124 @@
+#include "event_history.h"
+#include "simple/support/enum.hpp"
+
+using simple::support::to_integer;
+
+namespace simple::interactive
+{
+
+	event_history::event_history(std::size_t capacity) :
+		capacity_(capacity),
+		events(capacity),
+		keys(SDL_NUM_SCANCODES)
+	{
+		// any type can fill the whole history, so recording never allocates
+		for(auto& index : types)
+			index.reserve(capacity);
+	}
+
+	uint64_t event_history::first_sequence() const noexcept
+	{
+		return recorded - events.size();
+	}
+
+	void event_history::record(const event& e)
+	{
+		if(capacity_ == 0)
+			return;
+
+		if(events.size() == capacity_)
+		{
+			// the oldest event is also the oldest of its type
+			types[events.front().index()].pop_front();
+			events.pop_front();
+		}
+
+		const auto time = precise_timestamp(e);
+		events.push_back(e);
+		types[e.index()].push_back({time, recorded});
+		++recorded;
+
+		if(auto pressed = std::get_if<key_pressed>(&e); pressed && !pressed->data.repeat)
+		{
+			const std::size_t code = to_integer(pressed->data.scancode);
+			if(code < keys.size())
+			{
+				keys[code].previous = keys[code].last;
+				keys[code].last = time;
+			}
+		}
+	}
+
+	void event_history::clear() noexcept
+	{
+		events.clear();
+		for(auto& index : types)
+			index.clear();
+		for(auto& key : keys)
+			key = {};
+	}
+
+	std::size_t event_history::size() const noexcept
+	{
+		return events.size();
+	}
+
+	std::size_t event_history::capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	const event& event_history::operator[](std::size_t index) const noexcept
+	{
+		return events[index];
+	}
+
+	// first index in [0, size) for which the predicate is false, the predicate must be partitioning
+	template <typename Predicate>
+	std::size_t partition_point(std::size_t size, Predicate&& before) noexcept
+	{
+		std::size_t first = 0;
+		while(size > 0)
+		{
+			const std::size_t half = size / 2;
+			if(before(first + half))
+			{
+				first += half + 1;
+				size -= half + 1;
+			}
+			else
+				size = half;
+		}
+		return first;
+	}
+
+	std::size_t event_history::first_since(std::chrono::microseconds time) const noexcept
+	{
+		return partition_point(events.size(), [&](std::size_t i) { return precise_timestamp(events[i]) < time; });
+	}
+
+	std::size_t event_history::count(std::size_t event_index, std::chrono::microseconds since) const noexcept
+	{
+		const auto& index = types[event_index];
+		return index.size() - partition_point(index.size(), [&](std::size_t i) { return index[i].timestamp < since; });
+	}
+
+	std::optional<std::chrono::microseconds> event_history::last_pressed(scancode code) const noexcept
+	{
+		const std::size_t index = to_integer(code);
+		return index < keys.size() ? keys[index].last : std::nullopt;
+	}
+
+	std::optional<std::chrono::microseconds> event_history::previous_pressed(scancode code) const noexcept
+	{
+		const std::size_t index = to_integer(code);
+		return index < keys.size() ? keys[index].previous : std::nullopt;
+	}
+
+	bool event_history::pressed_within(scancode code, std::chrono::microseconds period, std::chrono::microseconds now) const noexcept
+	{
+		auto last = last_pressed(code);
+		return last && now - *last <= period;
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,94 @@
+#ifndef SIMPLE_INTERACTIVE_EVENT_HISTORY_H
+#define SIMPLE_INTERACTIVE_EVENT_HISTORY_H
+#include <array>
+#include <vector>
+#include "event.h"
+#include "ring.hpp"
+
+namespace simple::interactive
+{
+
+	// The most recent events, in the order recorded, up to a fixed count,
+	// with an index per event type and the last presses of each key, for queries like
+	// "was jump pressed in the last 100ms" or "how many clicks since".
+	// Timestamps are assumed to not go backwards.
+	// Everything is allocated up front, an index entry (16 bytes) for each event type and each event of capacity,
+	// so it's a fixed memory budget, and recording never allocates.
+	class event_history
+	{
+		public:
+		explicit event_history(std::size_t capacity);
+
+		// the oldest event is dropped when full
+		void record(const event&);
+
+		template <typename Events>
+		void record(const Events& events)
+		{
+			for(auto&& e : events)
+				record(e);
+		}
+
+		void clear() noexcept;
+
+		std::size_t size() const noexcept;
+		std::size_t capacity() const noexcept;
+
+		// index 0 is the oldest event
+		const event& operator[](std::size_t index) const noexcept;
+
+		// index of the first event at or after the time, size() if none, O(log n)
+		std::size_t first_since(std::chrono::microseconds time) const noexcept;
+
+		// events of the type at or after the time, O(log n)
+		std::size_t count(std::size_t event_index, std::chrono::microseconds since) const noexcept;
+
+		template <typename Event>
+		std::size_t count(std::chrono::microseconds since) const noexcept
+		{
+			return count(event_index<Event>, since);
+		}
+
+		// the latest event of the type, if it's still in the history, O(1)
+		template <typename Event>
+		const Event* last() const noexcept
+		{
+			const auto& index = types[event_index<Event>];
+			if(index.empty())
+				return nullptr;
+			return std::get_if<Event>(&events[index.back().sequence - first_sequence()]);
+		}
+
+		// Presses of each key, not counting repeats, O(1).
+		// These are kept per key, regardless of what's still in the history.
+		std::optional<std::chrono::microseconds> last_pressed(scancode) const noexcept;
+		std::optional<std::chrono::microseconds> previous_pressed(scancode) const noexcept;
+		// now in the clock of the recorded events' precise timestamps,
+		// SDL_GetTicks() for SDL events, the source's for others (CLOCK_MONOTONIC for evdev devices)
+		bool pressed_within(scancode, std::chrono::microseconds period, std::chrono::microseconds now) const noexcept;
+
+		private:
+		struct entry
+		{
+			std::chrono::microseconds timestamp;
+			uint64_t sequence;
+		};
+
+		struct presses
+		{
+			std::optional<std::chrono::microseconds> last;
+			std::optional<std::chrono::microseconds> previous;
+		};
+
+		uint64_t first_sequence() const noexcept;
+
+		std::size_t capacity_;
+		uint64_t recorded = 0;
+		ring<event> events;
+		std::array<ring<entry>, std::variant_size_v<event>> types;
+		std::vector<presses> keys;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
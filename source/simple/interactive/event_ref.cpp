@@ -0,0 +1,214 @@
+#include "event_ref.h"
+#include "queue.h"
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	std::size_t translated_index(const SDL_Event& event) noexcept
+	{
+		switch(event.type)
+		{
+			case SDL_KEYDOWN: return event_index<key_pressed>;
+			case SDL_KEYUP: return event_index<key_released>;
+			case SDL_MOUSEBUTTONDOWN: return event_index<mouse_down>;
+			case SDL_MOUSEBUTTONUP: return event_index<mouse_up>;
+			case SDL_MOUSEMOTION: return event_index<mouse_motion>;
+			case SDL_MOUSEWHEEL: return event_index<mouse_wheel>;
+			case SDL_TEXTINPUT: return event_index<text_input>;
+			case SDL_TEXTEDITING: return event_index<text_edit>;
+			case SDL_FINGERMOTION: return event_index<pointer_motion>;
+			case SDL_FINGERDOWN: return event_index<pointer_down>;
+			case SDL_FINGERUP: return event_index<pointer_up>;
+
+			case SDL_WINDOWEVENT: switch(event.window.event)
+			{
+				case SDL_WINDOWEVENT_SHOWN: return event_index<window_shown>;
+				case SDL_WINDOWEVENT_HIDDEN: return event_index<window_hidden>;
+				case SDL_WINDOWEVENT_EXPOSED: return event_index<window_exposed>;
+				case SDL_WINDOWEVENT_MOVED: return event_index<window_moved>;
+				case SDL_WINDOWEVENT_RESIZED: return event_index<window_resized>;
+				case SDL_WINDOWEVENT_SIZE_CHANGED: return event_index<window_size_changed>;
+				case SDL_WINDOWEVENT_MINIMIZED: return event_index<window_minimized>;
+				case SDL_WINDOWEVENT_MAXIMIZED: return event_index<window_maximized>;
+				case SDL_WINDOWEVENT_RESTORED: return event_index<window_restored>;
+				case SDL_WINDOWEVENT_ENTER: return event_index<window_entered>;
+				case SDL_WINDOWEVENT_LEAVE: return event_index<window_left>;
+				case SDL_WINDOWEVENT_FOCUS_GAINED: return event_index<window_focus_gained>;
+				case SDL_WINDOWEVENT_FOCUS_LOST: return event_index<window_focus_lost>;
+				case SDL_WINDOWEVENT_CLOSE: return event_index<window_closed>;
+#if SDL_VERSION_ATLEAST(2, 0, 5)
+				case SDL_WINDOWEVENT_TAKE_FOCUS: return event_index<window_take_focus>;
+				case SDL_WINDOWEVENT_HIT_TEST: return event_index<window_hit_test>;
+#endif
+			}
+			break;
+
+			case SDL_QUIT: return event_index<quit_request>;
+		}
+		return std::variant_npos;
+	}
+
+	event_ref::event_ref(const SDL_Event& event) noexcept :
+		raw_(event),
+		index_(translated_index(event))
+	{}
+
+	std::size_t event_ref::index() const noexcept
+	{
+		return index_;
+	}
+
+	event_ref::operator bool() const noexcept
+	{
+		return index_ != std::variant_npos;
+	}
+
+	std::chrono::milliseconds event_ref::timestamp() const noexcept
+	{
+		return std::chrono::milliseconds(raw_.common.timestamp);
+	}
+
+	std::chrono::microseconds event_ref::precise_timestamp() const noexcept
+	{
+		return timestamp();
+	}
+
+	uint32_t event_ref::window_id() const noexcept
+	{
+		switch(raw_.type)
+		{
+			case SDL_KEYDOWN: case SDL_KEYUP: return raw_.key.windowID;
+			case SDL_MOUSEBUTTONDOWN: case SDL_MOUSEBUTTONUP: return raw_.button.windowID;
+			case SDL_MOUSEMOTION: return raw_.motion.windowID;
+			case SDL_MOUSEWHEEL: return raw_.wheel.windowID;
+			case SDL_TEXTINPUT: return raw_.text.windowID;
+			case SDL_TEXTEDITING: return raw_.edit.windowID;
+			case SDL_WINDOWEVENT: return raw_.window.windowID;
+		}
+		return 0;
+	}
+
+	enum keycode event_ref::keycode() const noexcept
+	{
+		return static_cast<enum keycode>(raw_.key.keysym.sym);
+	}
+
+	enum scancode event_ref::scancode() const noexcept
+	{
+		return static_cast<enum scancode>(raw_.key.keysym.scancode);
+	}
+
+	uint8_t event_ref::repeat() const noexcept
+	{
+		return raw_.key.repeat;
+	}
+
+	keystate event_ref::state() const noexcept
+	{
+		return static_cast<keystate>(raw_.type == SDL_KEYDOWN || raw_.type == SDL_KEYUP
+			? raw_.key.state
+			: raw_.button.state);
+	}
+
+	int64_t event_ref::device_id() const noexcept
+	{
+		switch(raw_.type)
+		{
+			case SDL_MOUSEBUTTONDOWN: case SDL_MOUSEBUTTONUP: return raw_.button.which;
+			case SDL_MOUSEMOTION: return raw_.motion.which;
+			case SDL_MOUSEWHEEL: return raw_.wheel.which;
+		}
+		return raw_.tfinger.touchId;
+	}
+
+	int2 event_ref::position() const noexcept
+	{
+		switch(raw_.type)
+		{
+			case SDL_MOUSEMOTION: return int2(raw_.motion.x, raw_.motion.y);
+			case SDL_MOUSEWHEEL: return int2(raw_.wheel.x, raw_.wheel.y);
+		}
+		return int2(raw_.button.x, raw_.button.y);
+	}
+
+	int2 event_ref::motion() const noexcept
+	{
+		return int2(raw_.motion.xrel, raw_.motion.yrel);
+	}
+
+	mouse_button event_ref::button() const noexcept
+	{
+		return static_cast<mouse_button>(raw_.button.button);
+	}
+
+	mouse_button_mask event_ref::button_state() const noexcept
+	{
+		return static_cast<mouse_button_mask>(raw_.motion.state);
+	}
+
+	int64_t event_ref::pointer_id() const noexcept
+	{
+		return raw_.tfinger.fingerId;
+	}
+
+	float2 event_ref::pointer_position() const noexcept
+	{
+		return float2(raw_.tfinger.x, raw_.tfinger.y);
+	}
+
+	float2 event_ref::pointer_motion() const noexcept
+	{
+		return float2(raw_.tfinger.dx, raw_.tfinger.dy);
+	}
+
+	float event_ref::pressure() const noexcept
+	{
+		return raw_.tfinger.pressure;
+	}
+
+	std::string_view event_ref::text() const noexcept
+	{
+		const auto& text = raw_.type == SDL_TEXTEDITING ? raw_.edit.text : raw_.text.text;
+		return {text, static_cast<std::size_t>(std::find(text, text + sizeof(text), '\0') - text)};
+	}
+
+	int2 event_ref::value() const noexcept
+	{
+		return int2(raw_.window.data1, raw_.window.data2);
+	}
+
+	std::optional<event> event_ref::to_event() const noexcept
+	{
+		return translate(raw_);
+	}
+
+	event_ref::operator std::optional<event>() const noexcept
+	{
+		return to_event();
+	}
+
+	const SDL_Event& event_ref::raw() const noexcept
+	{
+		return raw_;
+	}
+
+	std::optional<event_ref> next_event_ref() noexcept
+	{
+		SDL_Event event;
+		while(poll_event(event))
+			if(event_ref ref(event); ref)
+				return ref;
+		return std::nullopt;
+	}
+
+	std::optional<event_ref> next_event_ref(no_pump_t) noexcept
+	{
+		SDL_Event event;
+		while(poll_event(event, no_pump))
+			if(event_ref ref(event); ref)
+				return ref;
+		return std::nullopt;
+	}
+
+} // namespace simple::interactive
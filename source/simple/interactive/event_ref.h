@@ -0,0 +1,80 @@
+#ifndef SIMPLE_INTERACTIVE_EVENT_REF_H
+#define SIMPLE_INTERACTIVE_EVENT_REF_H
+#include <string_view>
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	// position in the event variant of what translate() would make of the SDL event,
+	// std::variant_npos if it would skip it, test/event_ref.cpp checks that the two agree
+	std::size_t translated_index(const SDL_Event&) noexcept;
+
+	// Holds the raw SDL event, and decodes fields only when they are read.
+	// For code that looks at the type of most events and skips them,
+	// here that costs a switch, instead of building the whole event.
+	class event_ref
+	{
+		public:
+		explicit event_ref(const SDL_Event&) noexcept;
+
+		// same as the index of the translated event
+		std::size_t index() const noexcept;
+		// false for events translate() would skip
+		explicit operator bool() const noexcept;
+
+		template <typename Event>
+		bool is() const noexcept
+		{
+			return index_ == event_index<Event>;
+		}
+
+		std::chrono::milliseconds timestamp() const noexcept;
+		std::chrono::microseconds precise_timestamp() const noexcept;
+		// zero for events without a window
+		uint32_t window_id() const noexcept;
+
+		// the rest only make sense for events that have the corresponding data member
+
+		enum keycode keycode() const noexcept;
+		enum scancode scancode() const noexcept;
+		uint8_t repeat() const noexcept;
+		// keys and mouse buttons
+		keystate state() const noexcept;
+
+		// mouse or touch device
+		int64_t device_id() const noexcept;
+		// mouse position, or the wheel amount, same as the data member
+		int2 position() const noexcept;
+		int2 motion() const noexcept;
+		mouse_button button() const noexcept;
+		mouse_button_mask button_state() const noexcept;
+
+		int64_t pointer_id() const noexcept;
+		float2 pointer_position() const noexcept;
+		float2 pointer_motion() const noexcept;
+		float pressure() const noexcept;
+
+		// points into the raw event, for text input and edit
+		std::string_view text() const noexcept;
+
+		// window moved, resized or size changed
+		int2 value() const noexcept;
+
+		std::optional<event> to_event() const noexcept;
+		operator std::optional<event>() const noexcept;
+
+		const SDL_Event& raw() const noexcept;
+
+		private:
+		SDL_Event raw_;
+		std::size_t index_;
+	};
+
+	// same as next_event, but doesn't translate
+	std::optional<event_ref> next_event_ref() noexcept;
+	std::optional<event_ref> next_event_ref(no_pump_t) noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
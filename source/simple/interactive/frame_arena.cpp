@@ -0,0 +1,125 @@
+#include "frame_arena.h"
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	frame_arena::frame_arena(std::size_t block_size) :
+		block_size(block_size)
+	{
+	}
+
+	std::byte* frame_arena::bump(std::size_t size, std::size_t alignment) noexcept
+	{
+		if(current == blocks.size())
+			return nullptr;
+
+		auto& b = blocks[current];
+		const auto base = reinterpret_cast<std::uintptr_t>(b.memory.get());
+		const std::size_t start = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+		if(start > b.size || b.size - start < size)
+			return nullptr;
+
+		offset = start + size;
+		return b.memory.get() + start;
+	}
+
+	void* frame_arena::allocate(std::size_t size, std::size_t alignment)
+	{
+		// zero sized allocations still need distinct addresses
+		size = std::max<std::size_t>(size, 1);
+
+		auto memory = bump(size, alignment);
+		// the rest of the current block is wasted, but only until reset
+		while(!memory && current + 1 < blocks.size())
+		{
+			used_before += blocks[current].size;
+			++current;
+			offset = 0;
+			memory = bump(size, alignment);
+		}
+
+		if(!memory)
+		{
+			if(current < blocks.size())
+			{
+				used_before += blocks[current].size;
+				++current;
+			}
+			const std::size_t new_size = std::max(block_size, size + alignment - 1);
+			blocks.push_back({std::make_unique<std::byte[]>(new_size), new_size});
+			current = blocks.size() - 1;
+			offset = 0;
+			overflowed = true;
+			memory = bump(size, alignment);
+		}
+
+		high_water_mark = std::max(high_water_mark, frame_used());
+		last = memory;
+		return memory;
+	}
+
+	void frame_arena::deallocate(void* pointer, std::size_t size) noexcept
+	{
+		// only the latest allocation can be given back
+		if(pointer && pointer == last)
+		{
+			offset = static_cast<std::byte*>(pointer) - blocks[current].memory.get();
+			last = nullptr;
+		}
+		(void)size;
+	}
+
+	std::string_view frame_arena::copy(std::string_view text)
+	{
+		auto memory = static_cast<char*>(allocate(text.size(), 1));
+		std::memcpy(memory, text.data(), text.size());
+		return {memory, text.size()};
+	}
+
+	void frame_arena::reset() noexcept
+	{
+		// the first frame builds the arena up, only count overflows after that
+		if(overflowed && frames != 0)
+			++overflows;
+		overflowed = false;
+		++frames;
+
+		current = 0;
+		offset = 0;
+		used_before = 0;
+		last = nullptr;
+	}
+
+	void frame_arena::trim() noexcept
+	{
+		// the frames so far fit in the first blocks that add up to the high water mark,
+		// the first one is kept anyway, for idle frames not to go back and forth
+		std::size_t keep = 0;
+		for(std::size_t size = 0; keep < blocks.size() && size < high_water_mark; ++keep)
+			size += blocks[keep].size;
+		keep = std::max(keep, std::min<std::size_t>(blocks.size(), 1));
+		// never the ones in use, if called mid frame
+		if(frame_used() != 0)
+			keep = std::max(keep, current + 1);
+
+		blocks.erase(blocks.begin() + keep, blocks.end());
+		high_water_mark = frame_used();
+	}
+
+	std::size_t frame_arena::frame_used() const noexcept
+	{
+		return used_before + offset;
+	}
+
+	frame_arena_stats frame_arena::stats() const noexcept
+	{
+		std::size_t capacity = 0;
+		for(auto& b : blocks)
+			capacity += b.size;
+		return {frame_used(), high_water_mark, capacity, blocks.size(), overflows, frames};
+	}
+
+} // namespace simple::interactive
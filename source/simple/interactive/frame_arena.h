@@ -0,0 +1,136 @@
+#ifndef SIMPLE_INTERACTIVE_FRAME_ARENA_H
+#define SIMPLE_INTERACTIVE_FRAME_ARENA_H
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	struct frame_arena_stats
+	{
+		// bytes handed out since the last reset, including alignment padding
+		std::size_t used;
+		// the most bytes used in any one frame since the last trim
+		std::size_t high_water_mark;
+		// bytes held in all blocks
+		std::size_t capacity;
+		std::size_t blocks;
+		// frames that did not fit in what was there and needed a new block
+		std::size_t overflows;
+		std::size_t frames;
+	};
+
+	// Bump allocator for data that lives for one frame: drained events, text, coalesced and derived records.
+	// Allocating is moving a pointer, freeing is a no-op, except for the latest allocation which is given back,
+	// so short lived scratch allocations don't pile up. A growing vector leaves its old buffers behind
+	// (the new one is allocated before the old one is freed), reserve up front to avoid that.
+	// Everything is released at once with reset(), the blocks are kept, so once the arena is big enough for a frame it doesn't touch the heap anymore.
+	// Start with a block size around the high water mark to never need more than one block.
+	// The arena belongs to the caller, who hands it to what should allocate from it: drain_events(arena),
+	// window_coalescer::coalesce(arena_vector&), and anything that appends to a container (late_latch::take_latched,
+	// key_repeater::process output), given an arena_vector. The histories (event_history, motion_histories)
+	// outlive a frame, so they keep their own buffers, and event text is stored in the events themselves.
+	class frame_arena
+	{
+		public:
+		explicit frame_arena(std::size_t block_size = 64 * 1024);
+		frame_arena(const frame_arena&) = delete;
+		frame_arena& operator=(const frame_arena&) = delete;
+
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+		void deallocate(void* pointer, std::size_t size) noexcept;
+
+		// only for trivially destructible types, nothing is ever destroyed
+		template <typename T>
+		T* allocate_array(std::size_t count)
+		{
+			static_assert(std::is_trivially_destructible_v<T>);
+			return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+		}
+
+		std::string_view copy(std::string_view text);
+
+		// ends the frame, everything allocated so far is invalidated,
+		// containers using the arena must be gone or cleared before
+		void reset() noexcept;
+
+		// Frees the blocks the biggest frame since the last trim didn't need, and starts the high water mark over,
+		// so that a one off spike doesn't hold on to its memory for good. Call it every so often, right after reset().
+		void trim() noexcept;
+
+		frame_arena_stats stats() const noexcept;
+
+		private:
+		struct block
+		{
+			std::unique_ptr<std::byte[]> memory;
+			std::size_t size;
+		};
+
+		std::byte* bump(std::size_t size, std::size_t alignment) noexcept;
+		std::size_t frame_used() const noexcept;
+
+		std::vector<block> blocks;
+		std::size_t block_size;
+		std::size_t current = 0;
+		std::size_t offset = 0;
+		// bytes used in the blocks before the current one, including what was skipped at their ends
+		std::size_t used_before = 0;
+		std::byte* last = nullptr;
+
+		std::size_t high_water_mark = 0;
+		std::size_t overflows = 0;
+		std::size_t frames = 0;
+		bool overflowed = false;
+	};
+
+	template <typename T>
+	class arena_allocator
+	{
+		public:
+		using value_type = T;
+
+		arena_allocator(frame_arena& arena) noexcept : arena(&arena) {}
+
+		template <typename U>
+		arena_allocator(const arena_allocator<U>& other) noexcept : arena(other.arena) {}
+
+		T* allocate(std::size_t count)
+		{
+			return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* pointer, std::size_t count) noexcept
+		{
+			arena->deallocate(pointer, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const arena_allocator<U>& other) const noexcept { return arena == other.arena; }
+		template <typename U>
+		bool operator!=(const arena_allocator<U>& other) const noexcept { return arena != other.arena; }
+
+		private:
+		template <typename U> friend class arena_allocator;
+		frame_arena* arena;
+	};
+
+	template <typename T>
+	using arena_vector = std::vector<T, arena_allocator<T>>;
+
+	// appends all pending events to a vector that lives in the arena, until the frame is reset
+	template <typename... Pump>
+	arena_vector<event> drain_events(frame_arena& arena, Pump... pump)
+	{
+		arena_vector<event> events(arena);
+		drain_events(events, pump...);
+		return events;
+	}
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,387 @@
+#include "input_log.h"
+#include <cstring>
+
+namespace simple::interactive
+{
+
+	constexpr uint64_t zigzag(int64_t value) noexcept
+	{
+		return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+	}
+
+	constexpr int64_t unzigzag(uint64_t value) noexcept
+	{
+		return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+	}
+
+	// SDL timestamps are whole milliseconds, so those are stored as such, the low bit tells which
+	constexpr uint64_t encode_time(int64_t microseconds) noexcept
+	{
+		return microseconds % 1000 == 0
+			? zigzag(microseconds / 1000) << 1
+			: zigzag(microseconds) << 1 | 1;
+	}
+
+	constexpr int64_t decode_time(uint64_t value) noexcept
+	{
+		return value & 1
+			? unzigzag(value >> 1)
+			: unzigzag(value >> 1) * 1000;
+	}
+
+	input_log_writer::input_log_writer(uint8_t* begin, uint8_t* end, std::chrono::microseconds frame_time) noexcept :
+		out(begin), end(end), time(frame_time)
+	{}
+
+	void input_log_writer::put(uint8_t byte) noexcept
+	{
+		if(out == end)
+			overflow = true;
+		else
+			*out++ = byte;
+	}
+
+	void input_log_writer::put_varint(uint64_t value) noexcept
+	{
+		while(value >= 0x80)
+		{
+			put(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		put(static_cast<uint8_t>(value));
+	}
+
+	void input_log_writer::put_signed(int64_t value) noexcept
+	{
+		put_varint(zigzag(value));
+	}
+
+	void input_log_writer::put_float(float value) noexcept
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, sizeof bits);
+		for(int i = 0; i < 4; ++i, bits >>= 8)
+			put(static_cast<uint8_t>(bits));
+	}
+
+	void input_log_writer::put_position(int2 value) noexcept
+	{
+		put_signed(value.x() - mouse_position.x());
+		put_signed(value.y() - mouse_position.y());
+		mouse_position = value;
+	}
+
+	void input_log_writer::put_data(const event_data& data) noexcept
+	{
+		put_varint(encode_time((data.precise_timestamp - time).count()));
+		time = data.precise_timestamp;
+	}
+
+	void input_log_writer::put_data(const window_event_data& data) noexcept
+	{
+		put_data(static_cast<const event_data&>(data));
+		put_signed(int64_t(data.window_id) - int64_t(window_id));
+		window_id = data.window_id;
+	}
+
+	void input_log_writer::put_data(const key_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		put_varint(static_cast<uint32_t>(data.keycode));
+		put_varint(static_cast<uint32_t>(data.scancode));
+		put_varint(uint64_t(data.repeat) << 1 | (data.state == keystate::pressed));
+	}
+
+	void input_log_writer::put_data(const mouse_button_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		put_varint(data.device_id);
+		put_position(data.position);
+		put(static_cast<uint8_t>(data.button));
+#if SDL_VERSION_ATLEAST(2,0,2)
+		put_varint(uint64_t(data.clicks) << 1 | (data.state == keystate::pressed));
+#else
+		put_varint(data.state == keystate::pressed);
+#endif
+	}
+
+	void input_log_writer::put_data(const mouse_motion_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		put_varint(data.device_id);
+		put_position(data.position);
+		put_signed(data.motion.x());
+		put_signed(data.motion.y());
+		put_varint(static_cast<uint32_t>(data.button_state));
+	}
+
+	void input_log_writer::put_data(const mouse_wheel_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		put_varint(data.device_id);
+		// not a position, but the wheel motion
+		put_signed(data.position.x());
+		put_signed(data.position.y());
+#if SDL_VERSION_ATLEAST(2,0,4)
+		put_varint(static_cast<uint32_t>(data.direction));
+#endif
+	}
+
+	void input_log_writer::put_data(const text_input_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		std::size_t length = 0;
+		while(length < data.text.size() && data.text[length] != '\0')
+			++length;
+		put_varint(length);
+		for(std::size_t i = 0; i < length; ++i)
+			put(static_cast<uint8_t>(data.text[i]));
+	}
+
+	void input_log_writer::put_data(const text_edit_data& data) noexcept
+	{
+		put_data(static_cast<const text_input_data&>(data));
+		put_signed(data.edit_range.lower());
+		put_signed(data.edit_range.upper() - data.edit_range.lower());
+	}
+
+	void input_log_writer::put_data(const pointer_data& data) noexcept
+	{
+		put_data(static_cast<const event_data&>(data));
+		put_signed(data.device_id);
+		put_signed(data.pointer_id);
+		put_float(data.position.x());
+		put_float(data.position.y());
+		put_float(data.motion.x());
+		put_float(data.motion.y());
+		put_float(data.pressure);
+	}
+
+	void input_log_writer::put_data(const window_vector_data& data) noexcept
+	{
+		put_data(static_cast<const window_event_data&>(data));
+		put_signed(data.value.x());
+		put_signed(data.value.y());
+	}
+
+	bool input_log_writer::write(const event& e) noexcept
+	{
+		// zero terminates the frame
+		put(static_cast<uint8_t>(e.index() + 1));
+		std::visit([this](auto&& e) { put_data(e.data); }, e);
+		return !overflow;
+	}
+
+	uint8_t* input_log_writer::finish() noexcept
+	{
+		put(0);
+		return overflow ? nullptr : out;
+	}
+
+	input_log_reader::input_log_reader(const uint8_t* begin, const uint8_t* end, std::chrono::microseconds frame_time) noexcept :
+		in(begin), end(end), time(frame_time)
+	{}
+
+	uint8_t input_log_reader::get() noexcept
+	{
+		if(in == end)
+		{
+			malformed = true;
+			return 0;
+		}
+		return *in++;
+	}
+
+	uint64_t input_log_reader::get_varint() noexcept
+	{
+		uint64_t value = 0;
+		for(unsigned shift = 0; shift < 64; shift += 7)
+		{
+			const uint8_t byte = get();
+			value |= uint64_t(byte & 0x7f) << shift;
+			if(!(byte & 0x80))
+				return value;
+		}
+		malformed = true;
+		return 0;
+	}
+
+	int64_t input_log_reader::get_signed() noexcept
+	{
+		return unzigzag(get_varint());
+	}
+
+	float input_log_reader::get_float() noexcept
+	{
+		uint32_t bits = 0;
+		for(int i = 0; i < 4; ++i)
+			bits |= uint32_t(get()) << (i * 8);
+		float value;
+		std::memcpy(&value, &bits, sizeof value);
+		return value;
+	}
+
+	int2 input_log_reader::get_position() noexcept
+	{
+		const int x = mouse_position.x() + static_cast<int>(get_signed());
+		const int y = mouse_position.y() + static_cast<int>(get_signed());
+		return mouse_position = int2(x, y);
+	}
+
+	void input_log_reader::get_data(event_data& data) noexcept
+	{
+		time += std::chrono::microseconds(decode_time(get_varint()));
+		data = make_event_data(time);
+	}
+
+	void input_log_reader::get_data(window_event_data& data) noexcept
+	{
+		get_data(static_cast<event_data&>(data));
+		window_id += static_cast<uint32_t>(get_signed());
+		data.window_id = window_id;
+	}
+
+	void input_log_reader::get_data(key_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		data.keycode = static_cast<keycode>(get_varint());
+		data.scancode = static_cast<scancode>(get_varint());
+		const auto state = get_varint();
+		data.state = state & 1 ? keystate::pressed : keystate::released;
+		data.repeat = static_cast<uint8_t>(state >> 1);
+	}
+
+	void input_log_reader::get_data(mouse_button_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		data.device_id = static_cast<uint32_t>(get_varint());
+		data.position = get_position();
+		data.button = static_cast<mouse_button>(get());
+		const auto state = get_varint();
+		data.state = state & 1 ? keystate::pressed : keystate::released;
+#if SDL_VERSION_ATLEAST(2,0,2)
+		data.clicks = static_cast<uint8_t>(state >> 1);
+#endif
+	}
+
+	void input_log_reader::get_data(mouse_motion_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		data.device_id = static_cast<uint32_t>(get_varint());
+		data.position = get_position();
+		const int x = static_cast<int>(get_signed());
+		const int y = static_cast<int>(get_signed());
+		data.motion = int2(x, y);
+		data.button_state = static_cast<mouse_button_mask>(get_varint());
+	}
+
+	void input_log_reader::get_data(mouse_wheel_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		data.device_id = static_cast<uint32_t>(get_varint());
+		const int x = static_cast<int>(get_signed());
+		const int y = static_cast<int>(get_signed());
+		data.position = int2(x, y);
+#if SDL_VERSION_ATLEAST(2,0,4)
+		data.direction = static_cast<wheel_direction>(get_varint());
+#endif
+	}
+
+	void input_log_reader::get_data(text_input_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		const auto length = get_varint();
+		if(length > data.text.size())
+		{
+			malformed = true;
+			return;
+		}
+		data.text = {};
+		for(std::size_t i = 0; i < length; ++i)
+			data.text[i] = static_cast<char>(get());
+	}
+
+	void input_log_reader::get_data(text_edit_data& data) noexcept
+	{
+		get_data(static_cast<text_input_data&>(data));
+		const int start = static_cast<int>(get_signed());
+		const int length = static_cast<int>(get_signed());
+		data.edit_range = {start, start + length};
+	}
+
+	void input_log_reader::get_data(pointer_data& data) noexcept
+	{
+		get_data(static_cast<event_data&>(data));
+		data.device_id = get_signed();
+		data.pointer_id = get_signed();
+		const float x = get_float();
+		const float y = get_float();
+		data.position = float2(x, y);
+		const float dx = get_float();
+		const float dy = get_float();
+		data.motion = float2(dx, dy);
+		data.pressure = get_float();
+	}
+
+	void input_log_reader::get_data(window_vector_data& data) noexcept
+	{
+		get_data(static_cast<window_event_data&>(data));
+		const int x = static_cast<int>(get_signed());
+		const int y = static_cast<int>(get_signed());
+		data.value = int2(x, y);
+	}
+
+	template <typename Event>
+	std::optional<event> input_log_reader::get_event() noexcept
+	{
+		std::remove_const_t<decltype(Event::data)> data{};
+		get_data(data);
+		if(malformed)
+			return std::nullopt;
+		return Event{{data}};
+	}
+
+	template <std::size_t... I>
+	std::optional<event> input_log_reader::get_event(std::size_t index, std::index_sequence<I...>) noexcept
+	{
+		// events aren't assignable, so no folding into an optional
+		using getter = std::optional<event> (input_log_reader::*)() noexcept;
+		static constexpr getter getters[] = {&input_log_reader::get_event<std::variant_alternative_t<I, event>>...};
+		return (this->*getters[index])();
+	}
+
+	std::optional<event> input_log_reader::next() noexcept
+	{
+		if(done_ || malformed)
+			return std::nullopt;
+
+		const std::size_t tag = get();
+		if(malformed)
+			return std::nullopt;
+
+		if(tag == 0)
+		{
+			done_ = true;
+			return std::nullopt;
+		}
+
+		if(tag > std::variant_size_v<event>)
+		{
+			malformed = true;
+			return std::nullopt;
+		}
+
+		return get_event(tag - 1, std::make_index_sequence<std::variant_size_v<event>>{});
+	}
+
+	bool input_log_reader::done() const noexcept
+	{
+		return done_;
+	}
+
+	const uint8_t* input_log_reader::position() const noexcept
+	{
+		return in;
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,110 @@
+#ifndef SIMPLE_INTERACTIVE_INPUT_LOG_H
+#define SIMPLE_INTERACTIVE_INPUT_LOG_H
+#include <cstdint>
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	// Compact encoding of a frame's worth of events, for lockstep and rollback.
+	// Everything is a varint, timestamps, window ids and mouse positions are deltas from the previous event,
+	// the first timestamp is relative to the frame time both sides agree on.
+	// A frame depends on nothing but the frame time, so any of them can be decoded again on its own.
+	// An idle frame is a single byte. Neither side allocates.
+
+	// the most an event can take, some margin for the terminator included
+	constexpr std::size_t max_encoded_event_size = 64;
+
+	class input_log_writer
+	{
+		public:
+		input_log_writer(uint8_t* begin, uint8_t* end, std::chrono::microseconds frame_time) noexcept;
+
+		// false if the event didn't fit, the frame is unusable then
+		bool write(const event&) noexcept;
+
+		template <typename Events>
+		bool write(const Events& events) noexcept
+		{
+			for(auto&& e : events)
+				if(!write(e))
+					return false;
+			return true;
+		}
+
+		// terminates the frame, returns the end of it, or nullptr if anything didn't fit
+		uint8_t* finish() noexcept;
+
+		private:
+		void put(uint8_t) noexcept;
+		void put_varint(uint64_t) noexcept;
+		void put_signed(int64_t) noexcept;
+		void put_float(float) noexcept;
+		void put_position(int2) noexcept;
+		void put_data(const event_data&) noexcept;
+		void put_data(const window_event_data&) noexcept;
+		void put_data(const key_data&) noexcept;
+		void put_data(const mouse_button_data&) noexcept;
+		void put_data(const mouse_motion_data&) noexcept;
+		void put_data(const mouse_wheel_data&) noexcept;
+		void put_data(const text_input_data&) noexcept;
+		void put_data(const text_edit_data&) noexcept;
+		void put_data(const pointer_data&) noexcept;
+		void put_data(const window_vector_data&) noexcept;
+
+		uint8_t* out;
+		uint8_t* end;
+		bool overflow = false;
+		std::chrono::microseconds time;
+		uint32_t window_id = 0;
+		int2 mouse_position = int2::zero();
+	};
+
+	class input_log_reader
+	{
+		public:
+		input_log_reader(const uint8_t* begin, const uint8_t* end, std::chrono::microseconds frame_time) noexcept;
+
+		// nullopt at the end of the frame, or if the input is malformed
+		std::optional<event> next() noexcept;
+
+		// true once the end of the frame is reached, false if it stopped on malformed input
+		bool done() const noexcept;
+
+		// after done, the start of the next frame
+		const uint8_t* position() const noexcept;
+
+		private:
+		uint8_t get() noexcept;
+		uint64_t get_varint() noexcept;
+		int64_t get_signed() noexcept;
+		float get_float() noexcept;
+		int2 get_position() noexcept;
+		void get_data(event_data&) noexcept;
+		void get_data(window_event_data&) noexcept;
+		void get_data(key_data&) noexcept;
+		void get_data(mouse_button_data&) noexcept;
+		void get_data(mouse_motion_data&) noexcept;
+		void get_data(mouse_wheel_data&) noexcept;
+		void get_data(text_input_data&) noexcept;
+		void get_data(text_edit_data&) noexcept;
+		void get_data(pointer_data&) noexcept;
+		void get_data(window_vector_data&) noexcept;
+
+		template <typename Event>
+		std::optional<event> get_event() noexcept;
+		template <std::size_t... I>
+		std::optional<event> get_event(std::size_t index, std::index_sequence<I...>) noexcept;
+
+		const uint8_t* in;
+		const uint8_t* end;
+		bool malformed = false;
+		bool done_ = false;
+		std::chrono::microseconds time;
+		uint32_t window_id = 0;
+		int2 mouse_position = int2::zero();
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,175 @@
+#include "input_stream.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#include <unistd.h>
+
+namespace simple::interactive
+{
+
+	void write_le(uint8_t* out, uint64_t value, std::size_t size) noexcept
+	{
+		for(std::size_t i = 0; i < size; ++i, value >>= 8)
+			out[i] = static_cast<uint8_t>(value);
+	}
+
+	uint64_t read_le(const uint8_t* in, std::size_t size) noexcept
+	{
+		uint64_t value = 0;
+		for(std::size_t i = size; i-- > 0;)
+			value = value << 8 | in[i];
+		return value;
+	}
+
+	input_sender::input_sender(int fd) noexcept :
+		fd_(fd)
+	{}
+
+	void input_sender::queue_packet(std::size_t begin, std::chrono::microseconds frame_time)
+	{
+		packet p{{}, begin, payload.size()};
+		write_le(p.header.data(), p.end - p.begin, 4);
+		write_le(p.header.data() + 4, frame_time.count(), 8);
+		packets.push_back(p);
+		total += input_packet_header_size + p.end - p.begin;
+		// flush builds at most two parts per packet, up to the limit, and must not allocate
+		iov.reserve(std::min<std::size_t>(packets.size() * 2, IOV_MAX));
+	}
+
+	ssize_t input_sender::flush() noexcept
+	{
+		ssize_t result = 0;
+		while(written < total)
+		{
+			// skip what was already written, by a previous partial write
+			iov.clear();
+			std::size_t skip = written;
+			for(auto& p : packets)
+			{
+				iovec parts[2] =
+				{
+					{p.header.data(), p.header.size()},
+					{payload.data() + p.begin, p.end - p.begin}
+				};
+				for(auto& part : parts)
+				{
+					if(skip >= part.iov_len)
+					{
+						skip -= part.iov_len;
+						continue;
+					}
+					iov.push_back({static_cast<uint8_t*>(part.iov_base) + skip, part.iov_len - skip});
+					skip = 0;
+				}
+				if(iov.size() >= IOV_MAX - 1)
+					break;
+			}
+
+			do result = writev(fd_, iov.data(), iov.size());
+			while(result < 0 && errno == EINTR);
+
+			if(result <= 0)
+				return result;
+			written += result;
+		}
+
+		// keep the capacity for the next batch
+		payload.clear();
+		packets.clear();
+		written = total = 0;
+		return result;
+	}
+
+	std::size_t input_sender::pending() const noexcept
+	{
+		return total - written;
+	}
+
+	int input_sender::fd() const noexcept
+	{
+		return fd_;
+	}
+
+	input_receiver::input_receiver(int fd, std::size_t buffer_size) :
+		fd_(fd),
+		buffer(buffer_size)
+	{}
+
+	ssize_t input_receiver::fill() noexcept
+	{
+		// keep the partial packet, if any
+		const std::size_t leftover = buffer_end - buffer_begin;
+		std::memmove(buffer.data(), buffer.data() + buffer_begin, leftover);
+		buffer_begin = 0;
+		buffer_end = leftover;
+
+		ssize_t result;
+		do result = read(fd_, buffer.data() + buffer_end, buffer.size() - buffer_end);
+		while(result < 0 && errno == EINTR);
+
+		if(result > 0)
+			buffer_end += result;
+		return result;
+	}
+
+	bool input_receiver::start_packet() noexcept
+	{
+		const std::size_t available = buffer_end - buffer_begin;
+		if(available < input_packet_header_size)
+			return false;
+
+		const uint8_t* header = buffer.data() + buffer_begin;
+		const std::size_t size = input_packet_header_size + read_le(header, 4);
+		if(size > buffer.size())
+		{
+			malformed_ = true;
+			return false;
+		}
+		if(available < size)
+			return false;
+
+		const auto frame_time = std::chrono::microseconds(static_cast<int64_t>(read_le(header + 4, 8)));
+		packet_end = buffer_begin + size;
+		packet.emplace(header + input_packet_header_size, buffer.data() + packet_end, frame_time);
+		return true;
+	}
+
+	std::optional<event> input_receiver::next_event() noexcept
+	{
+		while(!malformed_)
+		{
+			if(packet)
+			{
+				if(auto e = packet->next())
+					return e;
+				if(!packet->done())
+				{
+					malformed_ = true;
+					break;
+				}
+				packet.reset();
+				buffer_begin = packet_end;
+			}
+
+			if(!start_packet() && (malformed_ || fill() <= 0))
+				break;
+		}
+		return std::nullopt;
+	}
+
+	bool input_receiver::malformed() const noexcept
+	{
+		return malformed_;
+	}
+
+	int input_receiver::fd() const noexcept
+	{
+		return fd_;
+	}
+
+} // namespace simple::interactive
+
+#endif
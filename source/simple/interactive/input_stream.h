@@ -0,0 +1,134 @@
+#ifndef SIMPLE_INTERACTIVE_INPUT_STREAM_H
+#define SIMPLE_INTERACTIVE_INPUT_STREAM_H
+#include "input_log.h"
+
+#if defined(__linux__)
+#include <array>
+#include <vector>
+#include <iterator>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+namespace simple::interactive
+{
+
+	// Events go over the stream in packets, each a header with the payload size and frame time,
+	// followed by an input_log frame of the events.
+	constexpr std::size_t input_packet_header_size = 12;
+
+	// Batches events into packets, written to a file descriptor (a unix socket, pipe, anything)
+	// with a single writev for all the pending packets.
+	// The buffers are kept between flushes, so a steady stream doesn't allocate.
+	class input_sender
+	{
+		public:
+		// does not take ownership of the file descriptor
+		explicit input_sender(int fd) noexcept;
+
+		// queues one packet with all the events,
+		// returns false and queues nothing if they didn't fit in the room made for them
+		template <typename Events>
+		bool send(const Events& events)
+		{
+			const std::size_t count = std::size(events);
+			if(count == 0)
+				return true;
+
+			const std::size_t begin = payload.size();
+			payload.resize(begin + count * max_encoded_event_size + 1);
+			input_log_writer writer(payload.data() + begin, payload.data() + payload.size(), precise_timestamp(*std::begin(events)));
+			writer.write(events);
+			const auto end = writer.finish();
+			if(!end)
+			{
+				payload.resize(begin);
+				return false;
+			}
+			payload.resize(end - payload.data());
+			queue_packet(begin, precise_timestamp(*std::begin(events)));
+			return true;
+		}
+
+		bool send(const event& e)
+		{
+			return send(std::array<event, 1>{e});
+		}
+
+		// writes out as much of the pending packets as the descriptor takes,
+		// returns the result of the last writev call, zero if there was nothing to write
+		ssize_t flush() noexcept;
+
+		// bytes not written yet
+		std::size_t pending() const noexcept;
+
+		int fd() const noexcept;
+
+		private:
+		struct packet
+		{
+			std::array<uint8_t, input_packet_header_size> header;
+			std::size_t begin;
+			std::size_t end;
+		};
+
+		void queue_packet(std::size_t begin, std::chrono::microseconds frame_time);
+
+		int fd_;
+		std::vector<uint8_t> payload;
+		std::vector<packet> packets;
+		std::vector<iovec> iov;
+		std::size_t written = 0;
+		std::size_t total = 0;
+	};
+
+	// Reads packets from an input_sender and provides the events, same as the local next_event.
+	class input_receiver
+	{
+		public:
+		// does not take ownership of the file descriptor,
+		// the buffer needs to fit the biggest packet
+		explicit input_receiver(int fd, std::size_t buffer_size = 1 << 16);
+
+		// reads from the descriptor only when out of buffered events,
+		// nullopt if nothing could be read, or the stream is malformed
+		std::optional<event> next_event() noexcept;
+
+		// appends all the events available without blocking, if the descriptor is non blocking
+		template <typename Container>
+		std::size_t drain_events(Container& events)
+		{
+			std::size_t count = 0;
+			while(auto e = next_event())
+			{
+				events.push_back(std::move(*e));
+				++count;
+			}
+			return count;
+		}
+
+		// reads as much as fits in the buffer with a single read() call,
+		// returns the result of the call
+		ssize_t fill() noexcept;
+
+		// the rest of the stream can't be trusted once this is set
+		bool malformed() const noexcept;
+
+		int fd() const noexcept;
+
+		private:
+		bool start_packet() noexcept;
+
+		int fd_;
+		std::vector<uint8_t> buffer;
+		std::size_t buffer_begin = 0;
+		std::size_t buffer_end = 0;
+		std::size_t packet_end = 0;
+		std::optional<input_log_reader> packet;
+		bool malformed_ = false;
+	};
+
+} // namespace simple::interactive
+
+#endif
+
+#endif /* end of include guard */
@@ -0,0 +1,82 @@
+#include "key_repeat.h"
+#include "simple/support/enum.hpp"
+
+using simple::support::to_integer;
+
+namespace simple::interactive
+{
+
+	key_repeater::key_repeater(repeat_rate default_rate) :
+		default_rate_(default_rate),
+		keys(SDL_NUM_SCANCODES, key{{}, {}, default_rate, false}),
+		wheel(SDL_NUM_SCANCODES)
+	{}
+
+	uint64_t key_repeater::to_tick(std::chrono::microseconds time) noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
+	}
+
+	void key_repeater::default_rate(repeat_rate rate) noexcept
+	{
+		default_rate_ = rate;
+		for(auto& key : keys)
+			if(!key.custom_rate)
+				key.rate = rate;
+	}
+
+	void key_repeater::rate(scancode code, repeat_rate rate) noexcept
+	{
+		if(std::size_t(to_integer(code)) >= keys.size())
+			return;
+		auto& key = keys[to_integer(code)];
+		key.rate = rate;
+		key.custom_rate = true;
+	}
+
+	void key_repeater::reset_rate(scancode code) noexcept
+	{
+		if(std::size_t(to_integer(code)) >= keys.size())
+			return;
+		auto& key = keys[to_integer(code)];
+		key.rate = default_rate_;
+		key.custom_rate = false;
+	}
+
+	repeat_rate key_repeater::rate(scancode code) const noexcept
+	{
+		return std::size_t(to_integer(code)) < keys.size() ? keys[to_integer(code)].rate : default_rate_;
+	}
+
+	void key_repeater::schedule(std::size_t code, std::chrono::microseconds due) noexcept
+	{
+		auto& key = keys[code];
+		if(key.rate.interval.count() <= 0)
+			return;
+		key.due = due;
+		// rounding up, so that a repeat never fires before it's due
+		wheel.schedule(code, std::chrono::ceil<std::chrono::milliseconds>(due).count());
+	}
+
+	void key_repeater::press(const key_data& data) noexcept
+	{
+		const std::size_t code = to_integer(data.scancode);
+		if(code >= keys.size())
+			return;
+		keys[code].press = data;
+		schedule(code, data.precise_timestamp + keys[code].rate.delay);
+	}
+
+	void key_repeater::release(scancode code) noexcept
+	{
+		if(std::size_t(to_integer(code)) < keys.size())
+			wheel.cancel(to_integer(code));
+	}
+
+	void key_repeater::release_all() noexcept
+	{
+		for(std::size_t code = 0; code < keys.size(); ++code)
+			wheel.cancel(code);
+	}
+
+} // namespace simple::interactive
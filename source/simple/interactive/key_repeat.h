@@ -0,0 +1,96 @@
+#ifndef SIMPLE_INTERACTIVE_KEY_REPEAT_H
+#define SIMPLE_INTERACTIVE_KEY_REPEAT_H
+#include <vector>
+#include "event.h"
+#include "timer_wheel.hpp"
+
+namespace simple::interactive
+{
+
+	struct repeat_rate
+	{
+		std::chrono::microseconds delay;
+		// zero disables repeating
+		std::chrono::microseconds interval;
+	};
+
+	// Replaces the OS key repeat with one that can be tuned per key.
+	// Events pass through process(), which drops the OS repeats,
+	// and emits synthesized ones (key_pressed with repeat set) that fall due before each event.
+	// Time is taken from event timestamps, or given to advance() when there are no events.
+	// Pending repeats sit on a timer wheel with millisecond ticks,
+	// so the cost doesn't depend on how many keys are held.
+	class key_repeater
+	{
+		public:
+		explicit key_repeater(repeat_rate default_rate = {std::chrono::milliseconds(500), std::chrono::milliseconds(33)});
+
+		void default_rate(repeat_rate) noexcept;
+		// scancodes out of range are ignored, and have the default rate
+		void rate(scancode, repeat_rate) noexcept;
+		void reset_rate(scancode) noexcept;
+		repeat_rate rate(scancode) const noexcept;
+
+		template <typename Output>
+		void process(const event& e, Output&& output)
+		{
+			advance(precise_timestamp(e), output);
+
+			if(auto pressed = std::get_if<key_pressed>(&e))
+			{
+				if(pressed->data.repeat)
+					return;
+				press(pressed->data);
+			}
+			else if(auto released = std::get_if<key_released>(&e))
+				release(released->data.scancode);
+
+			output(e);
+		}
+
+		template <typename Events, typename Output>
+		void process(const Events& events, Output&& output)
+		{
+			for(auto&& e : events)
+				process(e, output);
+		}
+
+		template <typename Output>
+		void advance(std::chrono::microseconds now, Output&& output)
+		{
+			wheel.advance(to_tick(now), [this, &output](std::size_t code, uint64_t)
+			{
+				auto& key = keys[code];
+				key_data data = key.press;
+				static_cast<event_data&>(data) = make_event_data(key.due);
+				data.repeat = 1;
+				schedule(code, key.due + key.rate.interval);
+				output(event{key_pressed{{data}}});
+			});
+		}
+
+		// stops all pending repeats, for example when focus is lost
+		void release_all() noexcept;
+
+		private:
+		struct key
+		{
+			key_data press;
+			std::chrono::microseconds due;
+			repeat_rate rate;
+			bool custom_rate;
+		};
+
+		static uint64_t to_tick(std::chrono::microseconds) noexcept;
+		void press(const key_data&) noexcept;
+		void release(scancode) noexcept;
+		void schedule(std::size_t code, std::chrono::microseconds due) noexcept;
+
+		repeat_rate default_rate_;
+		std::vector<key> keys;
+		timer_wheel wheel;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,89 @@
+#include "late_latch.h"
+#include <array>
+
+namespace simple::interactive
+{
+
+	void late_latch::cursor(int2& position, uint32_t window_id)
+	{
+		cursors.push_back({&position, window_id});
+	}
+
+	void late_latch::motion(float2& accumulated, const motion_curve& curve)
+	{
+		motions.push_back({&accumulated, curve});
+	}
+
+	void late_latch::clear() noexcept
+	{
+		cursors.clear();
+		motions.clear();
+	}
+
+	void late_latch::update(const mouse_motion_data& data) noexcept
+	{
+		for(auto& target : cursors)
+			if(target.window_id == 0 || target.window_id == data.window_id)
+				*target.position = data.position;
+
+		for(auto& target : motions)
+			*target.accumulated += apply(target.curve, data.motion);
+	}
+
+	void late_latch::keep(const mouse_motion_data& data)
+	{
+		auto previous = latched.find(data.device_id);
+		if(!previous)
+		{
+			latched.get(data.device_id, data);
+			return;
+		}
+
+		const int2 motion = previous->motion + data.motion;
+		*previous = data;
+		previous->motion = motion;
+	}
+
+	std::size_t late_latch::latch(no_pump_t)
+	{
+		// those go first, anything taken from SDL's queue would get ahead of them
+		if(buffered_events() != 0)
+			return 0;
+
+		std::array<SDL_Event, 64> batch;
+		std::size_t total = 0;
+		while(true)
+		{
+			const int peeked = SDL_PeepEvents(batch.data(), batch.size(), SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+			int front = 0;
+			while(front < peeked && batch[front].type == SDL_MOUSEMOTION)
+				++front;
+			if(front == 0)
+				break;
+
+			// events are only ever added at the back, so these are the same ones
+			const int taken = take_events(batch.data(), front, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+			for(int i = 0; i < taken; ++i)
+			{
+				if(auto translated = translate(batch[i]))
+				{
+					const auto& data = std::get<mouse_motion>(*translated).data;
+					update(data);
+					keep(data);
+				}
+			}
+			total += taken;
+
+			if(front < peeked || peeked < int(batch.size()))
+				break;
+		}
+		return total;
+	}
+
+	std::size_t late_latch::latch()
+	{
+		pump();
+		return latch(no_pump);
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,74 @@
+#ifndef SIMPLE_INTERACTIVE_LATE_LATCH_H
+#define SIMPLE_INTERACTIVE_LATE_LATCH_H
+#include <vector>
+#include "event.h"
+#include "motion.h"
+#include "device_table.hpp"
+
+namespace simple::interactive
+{
+
+	// Brings values read by the renderer up to date right before submission.
+	// The targets are registered when the frame is sampled, then latch() takes the mouse motion
+	// that arrived since, out of the queue, and updates the targets in place.
+	// Only motion at the front of the queue is taken, up to the first event of any other type,
+	// so nothing gets ahead of a click or a key press that came before it.
+	// Everything else stays in the queue for the next drain.
+	class late_latch
+	{
+		public:
+		// set to the latest mouse position, in window coordinates,
+		// of the given window, or any window if zero
+		void cursor(int2& position, uint32_t window_id = 0);
+
+		// the relative motion of all mice is added to it, through the curve
+		void motion(float2& accumulated, const motion_curve& curve = {});
+
+		// unregisters all targets
+		void clear() noexcept;
+
+		// returns the number of events taken,
+		// the no_pump version only sees events gathered by the last pump
+		std::size_t latch();
+		std::size_t latch(no_pump_t);
+
+		// The motion taken by latch, to hand on to the regular handling at the next drain,
+		// so that nothing is lost, but the targets were already updated with it.
+		// It was ahead of everything left in the queue, so call this before draining to keep the order.
+		// There is one event per mouse, the latest, with the motion of all the events taken since summed up,
+		// so this holds at most as many events as there are mice, however long it's not called.
+		// Returns the number of events appended.
+		template <typename Container>
+		std::size_t take_latched(Container& events)
+		{
+			for(auto&& data : latched.values())
+				events.push_back(mouse_motion{{data}});
+			const std::size_t count = latched.size();
+			latched.clear();
+			return count;
+		}
+
+		private:
+		struct cursor_target
+		{
+			int2* position;
+			uint32_t window_id;
+		};
+
+		struct motion_target
+		{
+			float2* accumulated;
+			motion_curve curve;
+		};
+
+		void update(const mouse_motion_data&) noexcept;
+		void keep(const mouse_motion_data&);
+
+		std::vector<cursor_target> cursors;
+		std::vector<motion_target> motions;
+		device_table<uint32_t, mouse_motion_data> latched;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
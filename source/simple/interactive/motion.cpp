@@ -0,0 +1,69 @@
+#include "motion.h"
+#include <cmath>
+
+namespace simple::interactive
+{
+
+	float2 apply(const motion_curve& curve, int2 motion) noexcept
+	{
+		float2 result = static_cast<float2>(motion) * curve.sensitivity;
+		if(curve.acceleration != 0.f)
+		{
+			const float speed = std::hypot(float(motion.x()), float(motion.y()));
+			const float gain = std::min(curve.max_gain,
+				1.f + curve.acceleration * std::pow(speed, curve.exponent));
+			result *= gain;
+		}
+		return result;
+	}
+
+	void motion_accumulator::default_curve(const motion_curve& curve) noexcept
+	{
+		default_curve_ = curve;
+	}
+
+	const motion_curve& motion_accumulator::default_curve() const noexcept
+	{
+		return default_curve_;
+	}
+
+	void motion_accumulator::curve(uint32_t device_id, const motion_curve& curve)
+	{
+		devices.get(device_id, {default_curve_, float2{}}).curve = curve;
+	}
+
+	void motion_accumulator::feed(const mouse_motion_data& data)
+	{
+		auto& device = devices.get(data.device_id, {default_curve_, float2{}});
+		device.motion += apply(device.curve, data.motion);
+	}
+
+	float2 motion_accumulator::motion(uint32_t device_id) const noexcept
+	{
+		auto device = devices.find(device_id);
+		return device ? device->motion : float2{};
+	}
+
+	float2 motion_accumulator::take(uint32_t device_id) noexcept
+	{
+		auto device = devices.find(device_id);
+		if(!device)
+			return float2{};
+
+		const float2 result = device->motion;
+		device->motion = float2{};
+		return result;
+	}
+
+	int2 motion_accumulator::take_whole(uint32_t device_id) noexcept
+	{
+		auto device = devices.find(device_id);
+		if(!device)
+			return int2{};
+
+		const float2 whole{std::trunc(device->motion.x()), std::trunc(device->motion.y())};
+		device->motion -= whole;
+		return static_cast<int2>(whole);
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,73 @@
+#ifndef SIMPLE_INTERACTIVE_MOTION_H
+#define SIMPLE_INTERACTIVE_MOTION_H
+#include <limits>
+#include "event.h"
+#include "device_table.hpp"
+
+namespace simple::interactive
+{
+
+	struct motion_curve
+	{
+		float2 sensitivity{1.f, 1.f};
+		// gain is 1 + acceleration * speed^exponent, capped at max_gain,
+		// where speed is the length of the motion reported in one sample
+		float acceleration = 0.f;
+		float exponent = 1.f;
+		float max_gain = std::numeric_limits<float>::infinity();
+	};
+
+	float2 apply(const motion_curve& curve, int2 motion) noexcept;
+
+	// Accumulates relative mouse motion per device in floating point,
+	// so that scaled down motion is not lost to rounding.
+	// Sensitivity can be set to a screen normalizing factor once,
+	// instead of normalizing each sample.
+	class motion_accumulator
+	{
+		public:
+		// applies to devices that have not been seen yet
+		void default_curve(const motion_curve&) noexcept;
+		const motion_curve& default_curve() const noexcept;
+
+		void curve(uint32_t device_id, const motion_curve&);
+
+		void feed(const mouse_motion_data&);
+
+		void feed(const event& e)
+		{
+			if(auto motion = std::get_if<mouse_motion>(&e))
+				feed(motion->data);
+		}
+
+		template <typename Events>
+		void feed(const Events& events)
+		{
+			for(auto&& e : events)
+				feed(e);
+		}
+
+		// accumulated motion so far
+		float2 motion(uint32_t device_id = 0) const noexcept;
+
+		// returns and resets the accumulated motion
+		float2 take(uint32_t device_id = 0) noexcept;
+
+		// returns the whole part of the accumulated motion,
+		// keeping the fraction for later
+		int2 take_whole(uint32_t device_id = 0) noexcept;
+
+		private:
+		struct device
+		{
+			motion_curve curve;
+			float2 motion;
+		};
+
+		motion_curve default_curve_;
+		device_table<uint32_t, device> devices;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
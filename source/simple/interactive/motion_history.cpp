@@ -0,0 +1,91 @@
+#include "motion_history.h"
+#include <cmath>
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	constexpr float two_pi = 6.28318530718f;
+
+	float smoothing_factor(float seconds, float cutoff) noexcept
+	{
+		// zero seconds gives zero, keeping the previous value
+		return seconds / (seconds + 1.f / (two_pi * cutoff));
+	}
+
+	void ema(const float* input, float* output, std::size_t count, float alpha, ema_state& state) noexcept
+	{
+		if(count == 0)
+			return;
+
+		float value = state.initialized ? state.value : input[0];
+		for(std::size_t i = 0; i < count; ++i)
+			output[i] = value += alpha * (input[i] - value);
+
+		state.value = value;
+		state.initialized = true;
+	}
+
+	void velocity(const int64_t* time, const float* input, float* output, std::size_t count,
+		int64_t previous_time, float previous_value) noexcept
+	{
+		if(count == 0)
+			return;
+
+		// no dependency between iterations, can be vectorized,
+		// going backwards so that output can alias input
+		for(std::size_t i = count - 1; i > 0; --i)
+		{
+			const float elapsed = float(time[i] - time[i - 1]);
+			output[i] = elapsed > 0.f ? (input[i] - input[i - 1]) * 1'000'000.f / elapsed : 0.f;
+		}
+
+		output[0] = previous_time < time[0]
+			? (input[0] - previous_value) * 1'000'000.f / float(time[0] - previous_time)
+			: 0.f;
+	}
+
+	void one_euro(const one_euro_parameters& parameters, const int64_t* time, const float* input, float* output, std::size_t count,
+		one_euro_state& state, float* scratch) noexcept
+	{
+		if(count == 0)
+			return;
+
+		if(!state.value.initialized)
+		{
+			state.value = {input[0], true};
+			state.derivative = {0.f, true};
+			state.time = time[0];
+			state.input = input[0];
+		}
+
+		float* derivative = scratch;
+		float* seconds = scratch + count;
+
+		// everything that doesn't depend on the previous output in separate passes
+		velocity(time, input, derivative, count, state.time, state.input);
+		seconds[0] = float(std::max<int64_t>(time[0] - state.time, 0)) / 1'000'000.f;
+		for(std::size_t i = 1; i < count; ++i)
+			seconds[i] = float(std::max<int64_t>(time[i] - time[i - 1], 0)) / 1'000'000.f;
+		for(std::size_t i = 0; i < count; ++i)
+			derivative[i] *= smoothing_factor(seconds[i], parameters.derivative_cutoff);
+
+		// before the output overwrites it
+		const float last_input = input[count - 1];
+
+		float value = state.value.value;
+		float smooth_derivative = state.derivative.value;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			smooth_derivative += derivative[i] - smooth_derivative * smoothing_factor(seconds[i], parameters.derivative_cutoff);
+			const float cutoff = parameters.min_cutoff + parameters.beta * std::abs(smooth_derivative);
+			output[i] = value += smoothing_factor(seconds[i], cutoff) * (input[i] - value);
+		}
+
+		state.value.value = value;
+		state.derivative.value = smooth_derivative;
+		state.time = time[count - 1];
+		state.input = last_input;
+	}
+
+} // namespace simple::interactive
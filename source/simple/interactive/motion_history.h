@@ -0,0 +1,192 @@
+#ifndef SIMPLE_INTERACTIVE_MOTION_HISTORY_H
+#define SIMPLE_INTERACTIVE_MOTION_HISTORY_H
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include "event.h"
+#include "device_table.hpp"
+
+namespace simple::interactive
+{
+
+	// The last Capacity samples of one pointer or mouse, each component in its own array.
+	// Every sample is written twice, Capacity apart, so the latest samples are always contiguous,
+	// and filters can run over them as plain arrays.
+	template <std::size_t Capacity>
+	class motion_history
+	{
+		public:
+		static constexpr std::size_t capacity = Capacity;
+
+		void push(int64_t time, float2 position, float2 motion, float pressure) noexcept
+		{
+			for(auto index : {next, next + Capacity})
+			{
+				time_[index] = time;
+				x_[index] = position.x();
+				y_[index] = position.y();
+				dx_[index] = motion.x();
+				dy_[index] = motion.y();
+				pressure_[index] = pressure;
+			}
+			next = (next + 1) % Capacity;
+			if(count < Capacity)
+				++count;
+			if(fresh_ < Capacity)
+				++fresh_;
+		}
+
+		void push(const pointer_data& data) noexcept
+		{
+			push(data.precise_timestamp.count(), data.position, data.motion, data.pressure);
+		}
+
+		void push(const mouse_motion_data& data) noexcept
+		{
+			push(data.precise_timestamp.count(), static_cast<float2>(data.position), static_cast<float2>(data.motion), 1.f);
+		}
+
+		void clear() noexcept
+		{
+			count = fresh_ = 0;
+		}
+
+		std::size_t size() const noexcept { return count; }
+
+		// samples pushed since the last take_fresh, capped at size
+		std::size_t fresh() const noexcept { return fresh_; }
+		std::size_t take_fresh() noexcept { return std::exchange(fresh_, 0); }
+
+		// size() samples each, oldest first, timestamps in microseconds
+		const int64_t* time() const noexcept { return time_.data() + first(); }
+		const float* x() const noexcept { return x_.data() + first(); }
+		const float* y() const noexcept { return y_.data() + first(); }
+		const float* dx() const noexcept { return dx_.data() + first(); }
+		const float* dy() const noexcept { return dy_.data() + first(); }
+		const float* pressure() const noexcept { return pressure_.data() + first(); }
+
+		private:
+		std::size_t first() const noexcept { return next + Capacity - count; }
+
+		std::array<int64_t, 2 * Capacity> time_{};
+		std::array<float, 2 * Capacity> x_{};
+		std::array<float, 2 * Capacity> y_{};
+		std::array<float, 2 * Capacity> dx_{};
+		std::array<float, 2 * Capacity> dy_{};
+		std::array<float, 2 * Capacity> pressure_{};
+		std::size_t next = 0;
+		std::size_t count = 0;
+		std::size_t fresh_ = 0;
+	};
+
+	// Histories of all mice and pointers seen in the events fed.
+	// A pointer's history starts over when it goes down.
+	// Once a pointer is up its history is kept only until another pointer goes down,
+	// which takes it over, so the table doesn't grow with platforms that never reuse pointer ids,
+	// it's only as big as the most pointers down at once.
+	template <std::size_t Capacity>
+	class motion_histories
+	{
+		public:
+		struct pointer_key
+		{
+			int64_t device_id;
+			int64_t pointer_id;
+			bool operator==(const pointer_key& other) const noexcept
+			{ return device_id == other.device_id && pointer_id == other.pointer_id; }
+		};
+
+		void feed(const event& e)
+		{
+			if(auto motion = std::get_if<mouse_motion>(&e))
+				mice.get(motion->data.device_id).push(motion->data);
+			else if(auto down = std::get_if<pointer_down>(&e))
+			{
+				auto& history = reuse({down->data.device_id, down->data.pointer_id});
+				history.clear();
+				history.push(down->data);
+			}
+			else if(auto motion = std::get_if<pointer_motion>(&e))
+				pointers.get({motion->data.device_id, motion->data.pointer_id}).push(motion->data);
+			else if(auto up = std::get_if<pointer_up>(&e))
+			{
+				const pointer_key key{up->data.device_id, up->data.pointer_id};
+				pointers.get(key).push(up->data);
+				if(std::find(lifted.begin(), lifted.end(), key) == lifted.end())
+					lifted.push_back(key);
+			}
+		}
+
+		template <typename Events>
+		void feed(const Events& events)
+		{
+			for(auto&& e : events)
+				feed(e);
+		}
+
+		device_table<uint32_t, motion_history<Capacity>> mice;
+		device_table<pointer_key, motion_history<Capacity>> pointers;
+
+		private:
+		motion_history<Capacity>& reuse(const pointer_key& key)
+		{
+			auto found = std::find(lifted.begin(), lifted.end(), key);
+			if(found == lifted.end() && !pointers.find(key) && !lifted.empty())
+				found = lifted.end() - 1;
+			if(found != lifted.end())
+			{
+				pointers.rekey(*found, key);
+				lifted.erase(found);
+			}
+			return pointers.get(key);
+		}
+
+		// pointers that are up, their histories can be taken over
+		std::vector<pointer_key> lifted;
+	};
+
+	struct ema_state
+	{
+		float value = 0.f;
+		bool initialized = false;
+	};
+
+	struct one_euro_parameters
+	{
+		// Hz
+		float min_cutoff = 1.f;
+		float beta = 0.f;
+		float derivative_cutoff = 1.f;
+	};
+
+	struct one_euro_state
+	{
+		ema_state value;
+		ema_state derivative;
+		int64_t time = 0;
+		// the derivative is of the raw input, not of the filtered value
+		float input = 0.f;
+	};
+
+	// The kernels run over whole arrays, in passes that vectorize where the math allows,
+	// leaving only the recurrence itself sequential.
+	// Output can alias input. Timestamps are in microseconds.
+
+	// exponential moving average, output = previous + alpha * (input - previous)
+	void ema(const float* input, float* output, std::size_t count, float alpha, ema_state&) noexcept;
+
+	// difference per second, the first sample gets the difference from previous_time/previous_value,
+	// or zero if previous_time is not less than its time
+	void velocity(const int64_t* time, const float* input, float* output, std::size_t count,
+		int64_t previous_time = 0, float previous_value = 0) noexcept;
+
+	// speed adaptive low pass filter (Casiez et al. 2012), for one component,
+	// scratch needs room for 2*count floats
+	void one_euro(const one_euro_parameters&, const int64_t* time, const float* input, float* output, std::size_t count,
+		one_euro_state&, float* scratch) noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
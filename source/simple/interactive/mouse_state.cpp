@@ -0,0 +1,79 @@
+#include "mouse_state.h"
+#include "simple/support/enum.hpp"
+
+using simple::support::to_integer;
+
+namespace simple::interactive
+{
+
+	mouse_state& mouse_state_table::state(uint32_t device_id)
+	{
+		if(device_id == touch_mouse_id)
+			return touch_;
+		return devices.get(device_id);
+	}
+
+	void mouse_state_table::update(const event& e)
+	{
+		std::visit([this](auto&& e)
+		{
+			using event_type = std::decay_t<decltype(e)>;
+			if constexpr (std::is_base_of_v<mouse_data, std::decay_t<decltype(e.data)>>)
+			{
+				auto& mouse = state(e.data.device_id);
+				mouse.timestamp = e.data.precise_timestamp;
+				mouse.window_id = e.data.window_id;
+
+				if constexpr (std::is_same_v<event_type, mouse_wheel>)
+				{
+#if SDL_VERSION_ATLEAST(2,0,4)
+					mouse.wheel += e.motion();
+#else
+					mouse.wheel += e.data.position;
+#endif
+				}
+				else
+					mouse.position = e.data.position;
+
+				if constexpr (std::is_same_v<event_type, mouse_motion>)
+					mouse.buttons = e.data.button_state;
+				else if constexpr (std::is_same_v<event_type, mouse_down>)
+					mouse.buttons = static_cast<mouse_button_mask>(
+						to_integer(mouse.buttons) | to_integer(to_mask(e.data.button)) );
+				else if constexpr (std::is_same_v<event_type, mouse_up>)
+					mouse.buttons = static_cast<mouse_button_mask>(
+						to_integer(mouse.buttons) & ~to_integer(to_mask(e.data.button)) );
+			}
+		}, e);
+	}
+
+	const mouse_state* mouse_state_table::find(uint32_t device_id) const noexcept
+	{
+		if(device_id == touch_mouse_id)
+			return &touch_;
+		return devices.find(device_id);
+	}
+
+	const mouse_state& mouse_state_table::touch() const noexcept
+	{
+		return touch_;
+	}
+
+	const std::vector<uint32_t>& mouse_state_table::device_ids() const noexcept
+	{
+		return devices.ids();
+	}
+
+	const std::vector<mouse_state>& mouse_state_table::states() const noexcept
+	{
+		return devices.values();
+	}
+
+	void mouse_state_table::reset_wheel() noexcept
+	{
+		for(auto& mouse : devices.values())
+			mouse.wheel = int2::zero();
+		touch_.wheel = int2::zero();
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,51 @@
+#ifndef SIMPLE_INTERACTIVE_MOUSE_STATE_H
+#define SIMPLE_INTERACTIVE_MOUSE_STATE_H
+#include "event.h"
+#include "device_table.hpp"
+
+namespace simple::interactive
+{
+
+	struct mouse_state
+	{
+		std::chrono::microseconds timestamp;
+		uint32_t window_id;
+		int2 position;
+		mouse_button_mask buttons;
+		// accumulated since last reset_wheel
+		int2 wheel;
+	};
+
+	// Tracks the state of each mouse separately, as reported by the event stream.
+	// The mouse emulated by touch input (touch_mouse_id) is kept apart from physical devices.
+	class mouse_state_table
+	{
+		public:
+		void update(const event&);
+
+		template <typename Events>
+		void update(const Events& events)
+		{
+			for(auto&& e : events)
+				update(e);
+		}
+
+		const mouse_state* find(uint32_t device_id) const noexcept;
+		const mouse_state& touch() const noexcept;
+
+		// parallel arrays, index of an id is the index of its state
+		const std::vector<uint32_t>& device_ids() const noexcept;
+		const std::vector<mouse_state>& states() const noexcept;
+
+		void reset_wheel() noexcept;
+
+		private:
+		mouse_state& state(uint32_t device_id);
+
+		device_table<uint32_t, mouse_state> devices;
+		mouse_state touch_{};
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,596 @@
+#include "names.h"
+#include "perfect_hash.hpp"
+#include "simple/support/enum.hpp"
+
+using simple::support::to_integer;
+
+namespace simple::interactive
+{
+
+	constexpr std::string_view enumerator_name(std::string_view name) noexcept
+	{
+		if(name.size() > 1 && name[0] == '_')
+			name.remove_prefix(1);
+		return name;
+	}
+
+#define KEYCODE_NAME(name) name_entry<keycode>{enumerator_name(#name), keycode::name}
+#define SCANCODE_NAME(name) name_entry<scancode>{enumerator_name(#name), scancode::name}
+
+	constexpr name_entry<keycode> keycode_entries[] =
+	{
+		KEYCODE_NAME(_0),
+		KEYCODE_NAME(_1),
+		KEYCODE_NAME(_2),
+		KEYCODE_NAME(_3),
+		KEYCODE_NAME(_4),
+		KEYCODE_NAME(_5),
+		KEYCODE_NAME(_6),
+		KEYCODE_NAME(_7),
+		KEYCODE_NAME(_8),
+		KEYCODE_NAME(_9),
+		KEYCODE_NAME(a),
+		KEYCODE_NAME(ac_back),
+		KEYCODE_NAME(ac_bookmarks),
+		KEYCODE_NAME(ac_forward),
+		KEYCODE_NAME(ac_home),
+		KEYCODE_NAME(ac_refresh),
+		KEYCODE_NAME(ac_search),
+		KEYCODE_NAME(ac_stop),
+		KEYCODE_NAME(again),
+		KEYCODE_NAME(alterase),
+		KEYCODE_NAME(ampersand),
+		KEYCODE_NAME(application),
+		KEYCODE_NAME(asterisk),
+		KEYCODE_NAME(at),
+		KEYCODE_NAME(audiomute),
+		KEYCODE_NAME(audionext),
+		KEYCODE_NAME(audioplay),
+		KEYCODE_NAME(audioprev),
+		KEYCODE_NAME(audiostop),
+		KEYCODE_NAME(b),
+		KEYCODE_NAME(backquote),
+		KEYCODE_NAME(backslash),
+		KEYCODE_NAME(backspace),
+		KEYCODE_NAME(brightnessdown),
+		KEYCODE_NAME(brightnessup),
+		KEYCODE_NAME(c),
+		KEYCODE_NAME(calculator),
+		KEYCODE_NAME(cancel),
+		KEYCODE_NAME(capslock),
+		KEYCODE_NAME(caret),
+		KEYCODE_NAME(clear),
+		KEYCODE_NAME(clearagain),
+		KEYCODE_NAME(colon),
+		KEYCODE_NAME(comma),
+		KEYCODE_NAME(computer),
+		KEYCODE_NAME(copy),
+		KEYCODE_NAME(crsel),
+		KEYCODE_NAME(currencysubunit),
+		KEYCODE_NAME(currencyunit),
+		KEYCODE_NAME(cut),
+		KEYCODE_NAME(d),
+		KEYCODE_NAME(decimalseparator),
+		KEYCODE_NAME(del),
+		KEYCODE_NAME(displayswitch),
+		KEYCODE_NAME(dollar),
+		KEYCODE_NAME(down),
+		KEYCODE_NAME(e),
+		KEYCODE_NAME(eject),
+		KEYCODE_NAME(end),
+		KEYCODE_NAME(equals),
+		KEYCODE_NAME(escape),
+		KEYCODE_NAME(exclaim),
+		KEYCODE_NAME(execute),
+		KEYCODE_NAME(exsel),
+		KEYCODE_NAME(f),
+		KEYCODE_NAME(f1),
+		KEYCODE_NAME(f10),
+		KEYCODE_NAME(f11),
+		KEYCODE_NAME(f12),
+		KEYCODE_NAME(f13),
+		KEYCODE_NAME(f14),
+		KEYCODE_NAME(f15),
+		KEYCODE_NAME(f16),
+		KEYCODE_NAME(f17),
+		KEYCODE_NAME(f18),
+		KEYCODE_NAME(f19),
+		KEYCODE_NAME(f2),
+		KEYCODE_NAME(f20),
+		KEYCODE_NAME(f21),
+		KEYCODE_NAME(f22),
+		KEYCODE_NAME(f23),
+		KEYCODE_NAME(f24),
+		KEYCODE_NAME(f3),
+		KEYCODE_NAME(f4),
+		KEYCODE_NAME(f5),
+		KEYCODE_NAME(f6),
+		KEYCODE_NAME(f7),
+		KEYCODE_NAME(f8),
+		KEYCODE_NAME(f9),
+		KEYCODE_NAME(find),
+		KEYCODE_NAME(g),
+		KEYCODE_NAME(greater),
+		KEYCODE_NAME(h),
+		KEYCODE_NAME(hash),
+		KEYCODE_NAME(help),
+		KEYCODE_NAME(home),
+		KEYCODE_NAME(i),
+		KEYCODE_NAME(insert),
+		KEYCODE_NAME(j),
+		KEYCODE_NAME(k),
+		KEYCODE_NAME(kbdillumdown),
+		KEYCODE_NAME(kbdillumtoggle),
+		KEYCODE_NAME(kbdillumup),
+		KEYCODE_NAME(kp_0),
+		KEYCODE_NAME(kp_00),
+		KEYCODE_NAME(kp_000),
+		KEYCODE_NAME(kp_1),
+		KEYCODE_NAME(kp_2),
+		KEYCODE_NAME(kp_3),
+		KEYCODE_NAME(kp_4),
+		KEYCODE_NAME(kp_5),
+		KEYCODE_NAME(kp_6),
+		KEYCODE_NAME(kp_7),
+		KEYCODE_NAME(kp_8),
+		KEYCODE_NAME(kp_9),
+		KEYCODE_NAME(kp_a),
+		KEYCODE_NAME(kp_ampersand),
+		KEYCODE_NAME(kp_at),
+		KEYCODE_NAME(kp_b),
+		KEYCODE_NAME(kp_backspace),
+		KEYCODE_NAME(kp_binary),
+		KEYCODE_NAME(kp_c),
+		KEYCODE_NAME(kp_clear),
+		KEYCODE_NAME(kp_clearentry),
+		KEYCODE_NAME(kp_colon),
+		KEYCODE_NAME(kp_comma),
+		KEYCODE_NAME(kp_d),
+		KEYCODE_NAME(kp_dblampersand),
+		KEYCODE_NAME(kp_dblverticalbar),
+		KEYCODE_NAME(kp_decimal),
+		KEYCODE_NAME(kp_divide),
+		KEYCODE_NAME(kp_e),
+		KEYCODE_NAME(kp_enter),
+		KEYCODE_NAME(kp_equals),
+		KEYCODE_NAME(kp_equalsas400),
+		KEYCODE_NAME(kp_exclam),
+		KEYCODE_NAME(kp_f),
+		KEYCODE_NAME(kp_greater),
+		KEYCODE_NAME(kp_hash),
+		KEYCODE_NAME(kp_hexadecimal),
+		KEYCODE_NAME(kp_leftbrace),
+		KEYCODE_NAME(kp_leftparen),
+		KEYCODE_NAME(kp_less),
+		KEYCODE_NAME(kp_memadd),
+		KEYCODE_NAME(kp_memclear),
+		KEYCODE_NAME(kp_memdivide),
+		KEYCODE_NAME(kp_memmultiply),
+		KEYCODE_NAME(kp_memrecall),
+		KEYCODE_NAME(kp_memstore),
+		KEYCODE_NAME(kp_memsubtract),
+		KEYCODE_NAME(kp_minus),
+		KEYCODE_NAME(kp_multiply),
+		KEYCODE_NAME(kp_octal),
+		KEYCODE_NAME(kp_percent),
+		KEYCODE_NAME(kp_period),
+		KEYCODE_NAME(kp_plus),
+		KEYCODE_NAME(kp_plusminus),
+		KEYCODE_NAME(kp_power),
+		KEYCODE_NAME(kp_rightbrace),
+		KEYCODE_NAME(kp_rightparen),
+		KEYCODE_NAME(kp_space),
+		KEYCODE_NAME(kp_tab),
+		KEYCODE_NAME(kp_verticalbar),
+		KEYCODE_NAME(kp_xor),
+		KEYCODE_NAME(l),
+		KEYCODE_NAME(lalt),
+		KEYCODE_NAME(lctrl),
+		KEYCODE_NAME(left),
+		KEYCODE_NAME(leftbracket),
+		KEYCODE_NAME(leftparen),
+		KEYCODE_NAME(less),
+		KEYCODE_NAME(lgui),
+		KEYCODE_NAME(lshift),
+		KEYCODE_NAME(m),
+		KEYCODE_NAME(mail),
+		KEYCODE_NAME(mediaselect),
+		KEYCODE_NAME(menu),
+		KEYCODE_NAME(minus),
+		KEYCODE_NAME(mode),
+		KEYCODE_NAME(mute),
+		KEYCODE_NAME(n),
+		KEYCODE_NAME(numlockclear),
+		KEYCODE_NAME(o),
+		KEYCODE_NAME(oper),
+		KEYCODE_NAME(out),
+		KEYCODE_NAME(p),
+		KEYCODE_NAME(pagedown),
+		KEYCODE_NAME(pageup),
+		KEYCODE_NAME(paste),
+		KEYCODE_NAME(pause),
+		KEYCODE_NAME(percent),
+		KEYCODE_NAME(period),
+		KEYCODE_NAME(plus),
+		KEYCODE_NAME(power),
+		KEYCODE_NAME(printscreen),
+		KEYCODE_NAME(prior),
+		KEYCODE_NAME(q),
+		KEYCODE_NAME(question),
+		KEYCODE_NAME(quote),
+		KEYCODE_NAME(quotedbl),
+		KEYCODE_NAME(r),
+		KEYCODE_NAME(ralt),
+		KEYCODE_NAME(rctrl),
+		KEYCODE_NAME(enter),
+		KEYCODE_NAME(return2),
+		KEYCODE_NAME(rgui),
+		KEYCODE_NAME(right),
+		KEYCODE_NAME(rightbracket),
+		KEYCODE_NAME(rightparen),
+		KEYCODE_NAME(rshift),
+		KEYCODE_NAME(s),
+		KEYCODE_NAME(scrolllock),
+		KEYCODE_NAME(select),
+		KEYCODE_NAME(semicolon),
+		KEYCODE_NAME(separator),
+		KEYCODE_NAME(slash),
+		KEYCODE_NAME(sleep),
+		KEYCODE_NAME(space),
+		KEYCODE_NAME(stop),
+		KEYCODE_NAME(sysreq),
+		KEYCODE_NAME(t),
+		KEYCODE_NAME(tab),
+		KEYCODE_NAME(thousandsseparator),
+		KEYCODE_NAME(u),
+		KEYCODE_NAME(underscore),
+		KEYCODE_NAME(undo),
+		KEYCODE_NAME(unknown),
+		KEYCODE_NAME(up),
+		KEYCODE_NAME(v),
+		KEYCODE_NAME(volumedown),
+		KEYCODE_NAME(volumeup),
+		KEYCODE_NAME(w),
+		KEYCODE_NAME(www),
+		KEYCODE_NAME(x),
+		KEYCODE_NAME(y),
+		KEYCODE_NAME(z)
+	};
+
+	constexpr name_entry<scancode> scancode_entries[] =
+	{
+		SCANCODE_NAME(_0),
+		SCANCODE_NAME(_1),
+		SCANCODE_NAME(_2),
+		SCANCODE_NAME(_3),
+		SCANCODE_NAME(_4),
+		SCANCODE_NAME(_5),
+		SCANCODE_NAME(_6),
+		SCANCODE_NAME(_7),
+		SCANCODE_NAME(_8),
+		SCANCODE_NAME(_9),
+		SCANCODE_NAME(a),
+		SCANCODE_NAME(ac_back),
+		SCANCODE_NAME(ac_bookmarks),
+		SCANCODE_NAME(ac_forward),
+		SCANCODE_NAME(ac_home),
+		SCANCODE_NAME(ac_refresh),
+		SCANCODE_NAME(ac_search),
+		SCANCODE_NAME(ac_stop),
+		SCANCODE_NAME(again),
+		SCANCODE_NAME(alterase),
+		SCANCODE_NAME(apostrophe),
+		SCANCODE_NAME(application),
+		SCANCODE_NAME(audiomute),
+		SCANCODE_NAME(audionext),
+		SCANCODE_NAME(audioplay),
+		SCANCODE_NAME(audioprev),
+		SCANCODE_NAME(audiostop),
+		SCANCODE_NAME(b),
+		SCANCODE_NAME(backslash),
+		SCANCODE_NAME(backspace),
+		SCANCODE_NAME(brightnessdown),
+		SCANCODE_NAME(brightnessup),
+		SCANCODE_NAME(c),
+		SCANCODE_NAME(calculator),
+		SCANCODE_NAME(cancel),
+		SCANCODE_NAME(capslock),
+		SCANCODE_NAME(clear),
+		SCANCODE_NAME(clearagain),
+		SCANCODE_NAME(comma),
+		SCANCODE_NAME(computer),
+		SCANCODE_NAME(copy),
+		SCANCODE_NAME(crsel),
+		SCANCODE_NAME(currencysubunit),
+		SCANCODE_NAME(currencyunit),
+		SCANCODE_NAME(cut),
+		SCANCODE_NAME(d),
+		SCANCODE_NAME(decimalseparator),
+		SCANCODE_NAME(del),
+		SCANCODE_NAME(displayswitch),
+		SCANCODE_NAME(down),
+		SCANCODE_NAME(e),
+		SCANCODE_NAME(eject),
+		SCANCODE_NAME(end),
+		SCANCODE_NAME(equals),
+		SCANCODE_NAME(escape),
+		SCANCODE_NAME(execute),
+		SCANCODE_NAME(exsel),
+		SCANCODE_NAME(f),
+		SCANCODE_NAME(f1),
+		SCANCODE_NAME(f10),
+		SCANCODE_NAME(f11),
+		SCANCODE_NAME(f12),
+		SCANCODE_NAME(f13),
+		SCANCODE_NAME(f14),
+		SCANCODE_NAME(f15),
+		SCANCODE_NAME(f16),
+		SCANCODE_NAME(f17),
+		SCANCODE_NAME(f18),
+		SCANCODE_NAME(f19),
+		SCANCODE_NAME(f2),
+		SCANCODE_NAME(f20),
+		SCANCODE_NAME(f21),
+		SCANCODE_NAME(f22),
+		SCANCODE_NAME(f23),
+		SCANCODE_NAME(f24),
+		SCANCODE_NAME(f3),
+		SCANCODE_NAME(f4),
+		SCANCODE_NAME(f5),
+		SCANCODE_NAME(f6),
+		SCANCODE_NAME(f7),
+		SCANCODE_NAME(f8),
+		SCANCODE_NAME(f9),
+		SCANCODE_NAME(find),
+		SCANCODE_NAME(g),
+		SCANCODE_NAME(grave),
+		SCANCODE_NAME(h),
+		SCANCODE_NAME(help),
+		SCANCODE_NAME(home),
+		SCANCODE_NAME(i),
+		SCANCODE_NAME(insert),
+		SCANCODE_NAME(international1),
+		SCANCODE_NAME(international2),
+		SCANCODE_NAME(international3),
+		SCANCODE_NAME(international4),
+		SCANCODE_NAME(international5),
+		SCANCODE_NAME(international6),
+		SCANCODE_NAME(international7),
+		SCANCODE_NAME(international8),
+		SCANCODE_NAME(international9),
+		SCANCODE_NAME(j),
+		SCANCODE_NAME(k),
+		SCANCODE_NAME(kbdillumdown),
+		SCANCODE_NAME(kbdillumtoggle),
+		SCANCODE_NAME(kbdillumup),
+		SCANCODE_NAME(kp_0),
+		SCANCODE_NAME(kp_00),
+		SCANCODE_NAME(kp_000),
+		SCANCODE_NAME(kp_1),
+		SCANCODE_NAME(kp_2),
+		SCANCODE_NAME(kp_3),
+		SCANCODE_NAME(kp_4),
+		SCANCODE_NAME(kp_5),
+		SCANCODE_NAME(kp_6),
+		SCANCODE_NAME(kp_7),
+		SCANCODE_NAME(kp_8),
+		SCANCODE_NAME(kp_9),
+		SCANCODE_NAME(kp_a),
+		SCANCODE_NAME(kp_ampersand),
+		SCANCODE_NAME(kp_at),
+		SCANCODE_NAME(kp_b),
+		SCANCODE_NAME(kp_backspace),
+		SCANCODE_NAME(kp_binary),
+		SCANCODE_NAME(kp_c),
+		SCANCODE_NAME(kp_clear),
+		SCANCODE_NAME(kp_clearentry),
+		SCANCODE_NAME(kp_colon),
+		SCANCODE_NAME(kp_comma),
+		SCANCODE_NAME(kp_d),
+		SCANCODE_NAME(kp_dblampersand),
+		SCANCODE_NAME(kp_dblverticalbar),
+		SCANCODE_NAME(kp_decimal),
+		SCANCODE_NAME(kp_divide),
+		SCANCODE_NAME(kp_e),
+		SCANCODE_NAME(kp_enter),
+		SCANCODE_NAME(kp_equals),
+		SCANCODE_NAME(kp_equalsas400),
+		SCANCODE_NAME(kp_exclam),
+		SCANCODE_NAME(kp_f),
+		SCANCODE_NAME(kp_greater),
+		SCANCODE_NAME(kp_hash),
+		SCANCODE_NAME(kp_hexadecimal),
+		SCANCODE_NAME(kp_leftbrace),
+		SCANCODE_NAME(kp_leftparen),
+		SCANCODE_NAME(kp_less),
+		SCANCODE_NAME(kp_memadd),
+		SCANCODE_NAME(kp_memclear),
+		SCANCODE_NAME(kp_memdivide),
+		SCANCODE_NAME(kp_memmultiply),
+		SCANCODE_NAME(kp_memrecall),
+		SCANCODE_NAME(kp_memstore),
+		SCANCODE_NAME(kp_memsubtract),
+		SCANCODE_NAME(kp_minus),
+		SCANCODE_NAME(kp_multiply),
+		SCANCODE_NAME(kp_octal),
+		SCANCODE_NAME(kp_percent),
+		SCANCODE_NAME(kp_period),
+		SCANCODE_NAME(kp_plus),
+		SCANCODE_NAME(kp_plusminus),
+		SCANCODE_NAME(kp_power),
+		SCANCODE_NAME(kp_rightbrace),
+		SCANCODE_NAME(kp_rightparen),
+		SCANCODE_NAME(kp_space),
+		SCANCODE_NAME(kp_tab),
+		SCANCODE_NAME(kp_verticalbar),
+		SCANCODE_NAME(kp_xor),
+		SCANCODE_NAME(l),
+		SCANCODE_NAME(lalt),
+		SCANCODE_NAME(lang1),
+		SCANCODE_NAME(lang2),
+		SCANCODE_NAME(lang3),
+		SCANCODE_NAME(lang4),
+		SCANCODE_NAME(lang5),
+		SCANCODE_NAME(lang6),
+		SCANCODE_NAME(lang7),
+		SCANCODE_NAME(lang8),
+		SCANCODE_NAME(lang9),
+		SCANCODE_NAME(lctrl),
+		SCANCODE_NAME(left),
+		SCANCODE_NAME(leftbracket),
+		SCANCODE_NAME(lgui),
+		SCANCODE_NAME(lshift),
+		SCANCODE_NAME(m),
+		SCANCODE_NAME(mail),
+		SCANCODE_NAME(mediaselect),
+		SCANCODE_NAME(menu),
+		SCANCODE_NAME(minus),
+		SCANCODE_NAME(mode),
+		SCANCODE_NAME(mute),
+		SCANCODE_NAME(n),
+		SCANCODE_NAME(nonusbackslash),
+		SCANCODE_NAME(nonushash),
+		SCANCODE_NAME(numlockclear),
+		SCANCODE_NAME(o),
+		SCANCODE_NAME(oper),
+		SCANCODE_NAME(out),
+		SCANCODE_NAME(p),
+		SCANCODE_NAME(pagedown),
+		SCANCODE_NAME(pageup),
+		SCANCODE_NAME(paste),
+		SCANCODE_NAME(pause),
+		SCANCODE_NAME(period),
+		SCANCODE_NAME(power),
+		SCANCODE_NAME(printscreen),
+		SCANCODE_NAME(prior),
+		SCANCODE_NAME(q),
+		SCANCODE_NAME(r),
+		SCANCODE_NAME(ralt),
+		SCANCODE_NAME(rctrl),
+		SCANCODE_NAME(enter),
+		SCANCODE_NAME(return2),
+		SCANCODE_NAME(rgui),
+		SCANCODE_NAME(right),
+		SCANCODE_NAME(rightbracket),
+		SCANCODE_NAME(rshift),
+		SCANCODE_NAME(s),
+		SCANCODE_NAME(scrolllock),
+		SCANCODE_NAME(select),
+		SCANCODE_NAME(semicolon),
+		SCANCODE_NAME(separator),
+		SCANCODE_NAME(slash),
+		SCANCODE_NAME(sleep),
+		SCANCODE_NAME(space),
+		SCANCODE_NAME(stop),
+		SCANCODE_NAME(sysreq),
+		SCANCODE_NAME(t),
+		SCANCODE_NAME(tab),
+		SCANCODE_NAME(thousandsseparator),
+		SCANCODE_NAME(u),
+		SCANCODE_NAME(undo),
+		SCANCODE_NAME(unknown),
+		SCANCODE_NAME(up),
+		SCANCODE_NAME(v),
+		SCANCODE_NAME(volumedown),
+		SCANCODE_NAME(volumeup),
+		SCANCODE_NAME(w),
+		SCANCODE_NAME(www),
+		SCANCODE_NAME(x),
+		SCANCODE_NAME(y),
+		SCANCODE_NAME(z)
+	};
+
+#undef KEYCODE_NAME
+#undef SCANCODE_NAME
+
+	constexpr name_entry<mouse_button> mouse_button_entries[] =
+	{
+		{"left", mouse_button::left},
+		{"right", mouse_button::right},
+		{"middle", mouse_button::middle},
+		{"x1", mouse_button::x1},
+		{"x2", mouse_button::x2},
+	};
+
+	// keycodes are either characters below 128, or scancodes with a mask bit
+	constexpr std::size_t keycode_name_slots = 128 + SDL_NUM_SCANCODES;
+
+	// other characters (latin-1 and beyond) have no names, they map past the end
+	constexpr std::size_t keycode_name_index(keycode code) noexcept
+	{
+		const auto key = to_integer(code);
+		if(key & SDLK_SCANCODE_MASK)
+			return 128 + (key & ~SDLK_SCANCODE_MASK);
+		return key < 128 ? key : keycode_name_slots;
+	}
+
+	template <std::size_t Size, typename Value, std::size_t N, typename Index>
+	constexpr auto make_name_array(const name_entry<Value> (&entries)[N], Index index)
+	{
+		std::array<std::string_view, Size> names{};
+		for(auto& entry : entries)
+		{
+			const std::size_t i = index(entry.value);
+			if(i < Size && names[i].empty())
+				names[i] = entry.name;
+		}
+		return names;
+	}
+
+	constexpr bool keycodes_indexable() noexcept
+	{
+		for(auto& entry : keycode_entries)
+			if(keycode_name_index(entry.value) >= keycode_name_slots)
+				return false;
+		return true;
+	}
+	static_assert(keycodes_indexable());
+
+	constexpr auto keycode_names = make_name_array<keycode_name_slots>(keycode_entries, keycode_name_index);
+	constexpr auto scancode_names = make_name_array<SDL_NUM_SCANCODES>(scancode_entries,
+		[](scancode code) { return std::size_t(to_integer(code)); });
+	constexpr auto mouse_button_names = make_name_array<SDL_BUTTON_X2 + 1>(mouse_button_entries,
+		[](mouse_button button) { return std::size_t(to_integer(button)); });
+
+	constexpr perfect_hash_map keycode_map(keycode_entries);
+	constexpr perfect_hash_map scancode_map(scancode_entries);
+	constexpr perfect_hash_map mouse_button_map(mouse_button_entries);
+
+	static_assert(keycode_map.find("F1") == keycode::f1);
+	static_assert(scancode_map.find("kp_enter") == scancode::kp_enter);
+	static_assert(!scancode_map.find("not a key"));
+
+	std::string_view to_string(keycode code) noexcept
+	{
+		const auto index = keycode_name_index(code);
+		return index < keycode_names.size() ? keycode_names[index] : std::string_view{};
+	}
+
+	std::string_view to_string(scancode code) noexcept
+	{
+		const std::size_t index = to_integer(code);
+		return index < scancode_names.size() ? scancode_names[index] : std::string_view{};
+	}
+
+	std::string_view to_string(mouse_button button) noexcept
+	{
+		const std::size_t index = to_integer(button);
+		return index < mouse_button_names.size() ? mouse_button_names[index] : std::string_view{};
+	}
+
+	std::optional<keycode> to_keycode(std::string_view name) noexcept
+	{
+		return keycode_map.find(name);
+	}
+
+	std::optional<scancode> to_scancode(std::string_view name) noexcept
+	{
+		return scancode_map.find(name);
+	}
+
+	std::optional<mouse_button> to_mouse_button(std::string_view name) noexcept
+	{
+		return mouse_button_map.find(name);
+	}
+
+} // namespace simple::interactive
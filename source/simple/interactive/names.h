@@ -0,0 +1,24 @@
+#ifndef SIMPLE_INTERACTIVE_NAMES_H
+#define SIMPLE_INTERACTIVE_NAMES_H
+#include <optional>
+#include <string_view>
+#include "codes.h"
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	// Names are the enumerator names, without the leading underscore of digits ("a", "f1", "kp_enter", "0").
+	// Empty for values without a name.
+	std::string_view to_string(keycode) noexcept;
+	std::string_view to_string(scancode) noexcept;
+	std::string_view to_string(mouse_button) noexcept;
+
+	// case insensitive
+	std::optional<keycode> to_keycode(std::string_view name) noexcept;
+	std::optional<scancode> to_scancode(std::string_view name) noexcept;
+	std::optional<mouse_button> to_mouse_button(std::string_view name) noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
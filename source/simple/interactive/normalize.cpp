@@ -0,0 +1,193 @@
+#include "normalize.h"
+#include <array>
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	constexpr std::size_t normalize_chunk = 64;
+
+	// out = in * scale + offset
+	struct normalization
+	{
+		float2 scale;
+		float2 offset;
+		bool valid;
+	};
+
+	constexpr normalization invalid_normalization{float2::zero(), float2::zero(), false};
+
+	normalization window_normalization(uint32_t window_id) noexcept
+	{
+		auto window = SDL_GetWindowFromID(window_id);
+		if(!window)
+			return invalid_normalization;
+
+		int2 size;
+		SDL_GetWindowSize(window, &size.x(), &size.y());
+		if(size.x() == 0 || size.y() == 0)
+			return invalid_normalization;
+
+		return {float2::one() / static_cast<float2>(size), float2::zero(), true};
+	}
+
+	normalization screen_normalization(uint32_t window_id, bool absolute) noexcept
+	{
+		auto window = SDL_GetWindowFromID(window_id);
+		if(!window)
+			return invalid_normalization;
+
+		SDL_DisplayMode mode;
+		if(SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(window), &mode) < 0)
+			return invalid_normalization;
+
+		const float2 scale = float2::one() / static_cast<float2>(int2(mode.w, mode.h));
+		float2 offset = float2::zero();
+		if(absolute)
+		{
+			int2 position;
+			SDL_GetWindowPosition(window, &position.x(), &position.y());
+			offset = static_cast<float2>(position) * scale;
+		}
+		return {scale, offset, true};
+	}
+
+	// remembers the last few windows, a batch rarely spans more
+	template <typename Lookup>
+	class normalization_cache
+	{
+		public:
+		explicit normalization_cache(Lookup lookup) : lookup(lookup) {}
+
+		const normalization& get(uint32_t window_id) noexcept
+		{
+			for(std::size_t i = 0; i < size; ++i)
+				if(ids[i] == window_id)
+					return values[i];
+
+			const std::size_t i = size < ids.size() ? size++ : next++ % ids.size();
+			ids[i] = window_id;
+			values[i] = lookup(window_id);
+			return values[i];
+		}
+
+		private:
+		Lookup lookup;
+		std::array<uint32_t, 8> ids{};
+		std::array<normalization, 8> values{};
+		std::size_t size = 0;
+		std::size_t next = 0;
+	};
+
+	// the cache is passed in, so that it lasts the whole batch even when the batch is gathered a chunk at a time
+	template <typename Lookup>
+	void normalize(normalization_cache<Lookup>& cache, const uint32_t* window_ids, const int* x, const int* y, std::size_t count,
+		float* out_x, float* out_y, bool* valid) noexcept
+	{
+		std::array<float, normalize_chunk> scale_x, scale_y, offset_x, offset_y;
+
+		for(std::size_t start = 0; start < count; start += normalize_chunk)
+		{
+			const std::size_t size = std::min(normalize_chunk, count - start);
+
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				const auto& n = cache.get(window_ids[start + i]);
+				scale_x[i] = n.scale.x();
+				scale_y[i] = n.scale.y();
+				offset_x[i] = n.offset.x();
+				offset_y[i] = n.offset.y();
+				valid[start + i] = n.valid;
+			}
+
+			// no branches, no lookups, just arrays
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				out_x[start + i] = float(x[start + i]) * scale_x[i] + offset_x[i];
+				out_y[start + i] = float(y[start + i]) * scale_y[i] + offset_y[i];
+			}
+		}
+	}
+
+	auto screen_lookup(bool absolute) noexcept
+	{
+		return [absolute](uint32_t window_id) { return screen_normalization(window_id, absolute); };
+	}
+
+	void window_normalize(const uint32_t* window_ids, const int* x, const int* y, std::size_t count,
+		float* out_x, float* out_y, bool* valid) noexcept
+	{
+		normalization_cache cache(window_normalization);
+		normalize(cache, window_ids, x, y, count, out_x, out_y, valid);
+	}
+
+	void screen_normalize(const uint32_t* window_ids, const int* x, const int* y, std::size_t count,
+		float* out_x, float* out_y, bool* valid, bool absolute) noexcept
+	{
+		normalization_cache cache(screen_lookup(absolute));
+		normalize(cache, window_ids, x, y, count, out_x, out_y, valid);
+	}
+
+	// gathers the fields into arrays a chunk at a time, for the functions above
+	template <typename Data, typename Field, typename Lookup>
+	void normalize_data(const Data* data, std::size_t count, float2* out, bool* valid,
+		Field field, Lookup lookup) noexcept
+	{
+		normalization_cache<Lookup> cache(lookup);
+		std::array<uint32_t, normalize_chunk> window_ids;
+		std::array<int, normalize_chunk> x, y;
+		std::array<float, normalize_chunk> out_x, out_y;
+
+		for(std::size_t start = 0; start < count; start += normalize_chunk)
+		{
+			const std::size_t size = std::min(normalize_chunk, count - start);
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				const auto& element = data[start + i];
+				const int2 value = field(element);
+				window_ids[i] = element.window_id;
+				x[i] = value.x();
+				y[i] = value.y();
+			}
+
+			normalize(cache, window_ids.data(), x.data(), y.data(), size, out_x.data(), out_y.data(), valid + start);
+
+			for(std::size_t i = 0; i < size; ++i)
+				out[start + i] = float2(out_x[i], out_y[i]);
+		}
+	}
+
+	constexpr auto position_field = [](const mouse_data& data) { return data.position; };
+	constexpr auto motion_field = [](const mouse_motion_data& data) { return data.motion; };
+
+	void window_normalized_positions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, position_field, window_normalization);
+	}
+
+	void screen_normalized_positions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, position_field, screen_lookup(true));
+	}
+
+	void window_normalized_positions(const mouse_button_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, position_field, window_normalization);
+	}
+
+	void screen_normalized_positions(const mouse_button_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, position_field, screen_lookup(true));
+	}
+
+	void window_normalized_motions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, motion_field, window_normalization);
+	}
+
+	void screen_normalized_motions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept
+	{
+		normalize_data(data, count, out, valid, motion_field, screen_lookup(false));
+	}
+
+} // namespace simple::interactive
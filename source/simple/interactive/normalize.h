@@ -0,0 +1,30 @@
+#ifndef SIMPLE_INTERACTIVE_NORMALIZE_H
+#define SIMPLE_INTERACTIVE_NORMALIZE_H
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	// Batch versions of the normalized position and motion getters.
+	// Window (and display) sizes are looked up once per window id per batch (not per element or per chunk),
+	// and the arithmetic runs over plain float arrays, in chunks, where the compiler can vectorize it.
+	// Instead of optionals, valid[i] is set to whether element i could be normalized,
+	// the output is zero where it could not.
+
+	// structure of arrays, positions or motions in window coordinates
+	void window_normalize(const uint32_t* window_ids, const int* x, const int* y, std::size_t count,
+		float* out_x, float* out_y, bool* valid) noexcept;
+	// absolute for positions, which are offset by the window position, not for motions
+	void screen_normalize(const uint32_t* window_ids, const int* x, const int* y, std::size_t count,
+		float* out_x, float* out_y, bool* valid, bool absolute = true) noexcept;
+
+	void window_normalized_positions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+	void screen_normalized_positions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+	void window_normalized_positions(const mouse_button_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+	void screen_normalized_positions(const mouse_button_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+	void window_normalized_motions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+	void screen_normalized_motions(const mouse_motion_data* data, std::size_t count, float2* out, bool* valid) noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,148 @@
+#ifndef SIMPLE_INTERACTIVE_PERFECT_HASH_HPP
+#define SIMPLE_INTERACTIVE_PERFECT_HASH_HPP
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace simple::interactive
+{
+
+	constexpr char to_lower_ascii(char c) noexcept
+	{
+		return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+	}
+
+	constexpr bool equal_ignoring_case(std::string_view a, std::string_view b) noexcept
+	{
+		if(a.size() != b.size())
+			return false;
+		for(std::size_t i = 0; i < a.size(); ++i)
+			if(to_lower_ascii(a[i]) != to_lower_ascii(b[i]))
+				return false;
+		return true;
+	}
+
+	// FNV-1a over lowercase characters, with a murmur finalizer, since only the low bits are used
+	constexpr uint32_t name_hash(std::string_view name, uint32_t seed) noexcept
+	{
+		uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+		for(char c : name)
+		{
+			hash ^= static_cast<unsigned char>(to_lower_ascii(c));
+			hash *= 16777619u;
+		}
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6bu;
+		hash ^= hash >> 13;
+		hash *= 0xc2b2ae35u;
+		hash ^= hash >> 16;
+		return hash;
+	}
+
+	template <typename Value>
+	struct name_entry
+	{
+		std::string_view name;
+		Value value;
+	};
+
+	// Case insensitive name to value map, built at compile time with hash and displace:
+	// names are grouped into buckets by one hash, then each bucket, biggest first,
+	// gets a seed for a second hash that puts all of its names in free slots.
+	// A lookup is two hashes and one comparison.
+	template <typename Value, std::size_t N>
+	class perfect_hash_map
+	{
+		static constexpr std::size_t slot_count = [](){ std::size_t size = 1; while(size < 2 * N) size *= 2; return size; }();
+		static constexpr std::size_t bucket_count = N / 4 + 1;
+		static constexpr uint16_t empty = UINT16_MAX;
+		static_assert(N < empty);
+
+		public:
+		constexpr explicit perfect_hash_map(const name_entry<Value> (&entries)[N]) noexcept
+		{
+			for(std::size_t i = 0; i < N; ++i)
+				this->entries[i] = entries[i];
+			for(auto& slot : slots)
+				slot = empty;
+
+			std::array<std::size_t, bucket_count> sizes{};
+			std::array<std::size_t, N> bucket_of{};
+			for(std::size_t i = 0; i < N; ++i)
+			{
+				bucket_of[i] = name_hash(entries[i].name, 0) % bucket_count;
+				++sizes[bucket_of[i]];
+			}
+
+			std::array<std::size_t, bucket_count> order{};
+			for(std::size_t i = 0; i < bucket_count; ++i)
+				order[i] = i;
+			for(std::size_t i = 1; i < bucket_count; ++i)
+				for(std::size_t j = i; j > 0 && sizes[order[j - 1]] < sizes[order[j]]; --j)
+				{
+					auto t = order[j];
+					order[j] = order[j - 1];
+					order[j - 1] = t;
+				}
+
+			for(auto bucket : order)
+			{
+				if(sizes[bucket] == 0)
+					break;
+
+				for(uint32_t seed = 1; ; ++seed)
+				{
+					bool fits = true;
+					for(std::size_t i = 0; i < N && fits; ++i)
+					{
+						if(bucket_of[i] != bucket)
+							continue;
+						auto& slot = slots[name_hash(entries[i].name, seed) & (slot_count - 1)];
+						if(slot == empty)
+							slot = i;
+						else
+							fits = false;
+					}
+
+					if(fits)
+					{
+						seeds[bucket] = seed;
+						break;
+					}
+
+					// undo the partial placement
+					for(auto& slot : slots)
+						if(slot != empty && bucket_of[slot] == bucket)
+							slot = empty;
+				}
+			}
+		}
+
+		constexpr std::optional<Value> find(std::string_view name) const noexcept
+		{
+			const auto seed = seeds[name_hash(name, 0) % bucket_count];
+			const auto index = slots[name_hash(name, seed) & (slot_count - 1)];
+			if(index != empty && equal_ignoring_case(entries[index].name, name))
+				return entries[index].value;
+			return std::nullopt;
+		}
+
+		constexpr const std::array<name_entry<Value>, N>& all() const noexcept
+		{
+			return entries;
+		}
+
+		private:
+		std::array<name_entry<Value>, N> entries{};
+		std::array<uint16_t, slot_count> slots{};
+		std::array<uint32_t, bucket_count> seeds{};
+	};
+
+	template <typename Value, std::size_t N>
+	perfect_hash_map(const name_entry<Value> (&)[N]) -> perfect_hash_map<Value, N>;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,313 @@
+#include "queue.h"
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include "ring.hpp"
+#include "codes.h"
+
+namespace simple::interactive
+{
+
+	struct queue_monitor
+	{
+		bool tracking = false;
+		bool draining = false;
+		bool priority_lanes = false;
+		std::size_t high_water_mark = 0;
+		std::size_t spill_limit = 0;
+		// what the spills so far would have needed to take all of SDL's queue
+		std::size_t spill_wanted = 0;
+		// event watches can be invoked from any thread that pushes events
+		std::atomic<std::size_t> pushed{0};
+		std::size_t received = 0;
+		queue_stats stats{};
+		ring<SDL_Event> spill;
+		ring<SDL_Event> priority;
+	};
+
+	queue_monitor event_queue;
+
+	int count_pushed(void* monitor, SDL_Event*)
+	{
+		static_cast<queue_monitor*>(monitor)->pushed.fetch_add(1, std::memory_order_relaxed);
+		return 1;
+	}
+
+	int queue_depth() noexcept
+	{
+		return SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+	}
+
+	constexpr std::size_t priority_capacity = 256;
+
+	// moves events of the given range of types out of SDL's queue, in order,
+	// as many as fit in the destination without growing it, the rest stay where they were
+	std::size_t move_events(ring<SDL_Event>& destination, uint32_t first_type, uint32_t last_type) noexcept
+	{
+		std::array<SDL_Event, 64> batch;
+		std::size_t total = 0;
+		int wanted, taken;
+		do
+		{
+			wanted = int(std::min(batch.size(), destination.capacity() - destination.size()));
+			if(wanted == 0)
+				break;
+			taken = SDL_PeepEvents(batch.data(), wanted, SDL_GETEVENT, first_type, last_type);
+			for(int i = 0; i < taken; ++i)
+				destination.push_back(batch[i]);
+			if(taken > 0)
+				total += taken;
+		}
+		while(taken == wanted);
+		event_queue.received += total;
+		return total;
+	}
+
+	void spill_events(std::size_t depth) noexcept
+	{
+		event_queue.spill_wanted = std::max(event_queue.spill_wanted, event_queue.spill.size() + depth);
+		++event_queue.stats.spills;
+		event_queue.stats.spilled_events += move_events(event_queue.spill, SDL_FIRSTEVENT, SDL_LASTEVENT);
+	}
+
+	// the same events that stop coalescing, everything else keeps its place relative to input
+	bool priority_event(const SDL_Event& event) noexcept
+	{
+		if(event.type == SDL_QUIT)
+			return true;
+		if(event.type != SDL_WINDOWEVENT)
+			return false;
+		switch(event.window.event)
+		{
+			case SDL_WINDOWEVENT_CLOSE:
+			case SDL_WINDOWEVENT_FOCUS_GAINED:
+			case SDL_WINDOWEVENT_FOCUS_LOST:
+#if SDL_VERSION_ATLEAST(2,0,5)
+			case SDL_WINDOWEVENT_TAKE_FOCUS:
+#endif
+				return true;
+		}
+		return false;
+	}
+
+	// SDL calls it for every queued event, in order, with the queue locked, so no SDL calls in here
+	int take_priority_event(void* monitor, SDL_Event* event)
+	{
+		auto& queue = *static_cast<queue_monitor*>(monitor);
+		if(!priority_event(*event) || queue.priority.full())
+			return 1;
+		queue.priority.push_back(*event);
+		++queue.received;
+		// removed from SDL's queue
+		return 0;
+	}
+
+	void take_priority_events() noexcept
+	{
+		// they are picked from anywhere in the queue, a range of types can't express that
+		if(SDL_HasEvents(SDL_QUIT, SDL_WINDOWEVENT))
+			SDL_FilterEvents(take_priority_event, &event_queue);
+	}
+
+	// library state that depends on the event stream
+	void observe(const SDL_Event& event) noexcept
+	{
+		switch(event.type)
+		{
+#if SDL_VERSION_ATLEAST(2,0,4)
+			case SDL_KEYMAPCHANGED:
+				invalidate_keymap();
+			break;
+#else
+			// no keymap change event yet, the layout might have been switched while away
+			case SDL_WINDOWEVENT:
+				if(event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED)
+					invalidate_keymap();
+			break;
+#endif
+		}
+	}
+
+	void measure_queue_pressure(bool pumping) noexcept;
+
+	bool take_event(SDL_Event& event, bool pumping) noexcept
+	{
+		// once for the lanes, the pressure check and the first event
+		bool pumped = false;
+		if(!event_queue.draining)
+		{
+			event_queue.draining = true;
+			if(pumping && (event_queue.priority_lanes || event_queue.tracking || event_queue.high_water_mark))
+			{
+				SDL_PumpEvents();
+				pumped = true;
+			}
+			if(event_queue.priority_lanes)
+				take_priority_events();
+			measure_queue_pressure(false);
+		}
+
+		if(!event_queue.priority.empty())
+		{
+			event = event_queue.priority.front();
+			event_queue.priority.pop_front();
+		}
+		else if(!event_queue.spill.empty())
+		{
+			event = event_queue.spill.front();
+			event_queue.spill.pop_front();
+		}
+		else if(pumping && !pumped
+			? SDL_PollEvent(&event)
+			: SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0)
+			++event_queue.received;
+		else
+		{
+			event_queue.draining = false;
+			return false;
+		}
+
+		observe(event);
+		return true;
+	}
+
+	std::size_t buffered_events() noexcept
+	{
+		return event_queue.priority.size() + event_queue.spill.size();
+	}
+
+	void pump() noexcept
+	{
+		SDL_PumpEvents();
+		begin_drain();
+	}
+
+	void begin_drain() noexcept
+	{
+		event_queue.draining = false;
+	}
+
+	bool wait_for_events(int timeout) noexcept
+	{
+		if(!event_queue.priority.empty() || !event_queue.spill.empty())
+			return true;
+		// without an event to fill SDL leaves them in the queue
+		return (timeout < 0 ? SDL_WaitEvent(nullptr) : SDL_WaitEventTimeout(nullptr, timeout)) != 0;
+	}
+
+	int take_events(SDL_Event* events, int count, uint32_t first_type, uint32_t last_type) noexcept
+	{
+		const int taken = SDL_PeepEvents(events, count, SDL_GETEVENT, first_type, last_type);
+		if(taken <= 0)
+			return 0;
+
+		event_queue.received += taken;
+		for(int i = 0; i < taken; ++i)
+			observe(events[i]);
+		return taken;
+	}
+
+	bool poll_event(SDL_Event& event) noexcept
+	{
+		return take_event(event, true);
+	}
+
+	bool poll_event(SDL_Event& event, no_pump_t) noexcept
+	{
+		return take_event(event, false);
+	}
+
+	void track_queue_pressure(bool enable) noexcept
+	{
+		if(enable == event_queue.tracking)
+			return;
+
+		event_queue.tracking = enable;
+		if(enable)
+		{
+			// whatever is queued already counts as pushed,
+			// an event pushed before the watch is added is missed, under reporting drops is the lesser evil
+			event_queue.received = 0;
+			event_queue.pushed = std::max(queue_depth(), 0);
+			SDL_AddEventWatch(count_pushed, &event_queue);
+		}
+		else
+			SDL_DelEventWatch(count_pushed, &event_queue);
+	}
+
+	void priority_lanes(bool enable)
+	{
+		if(enable)
+			event_queue.priority.reserve(priority_capacity);
+		event_queue.priority_lanes = enable;
+	}
+
+	void spill_mode(std::size_t high_water_mark, std::size_t capacity)
+	{
+		// a spill takes more than the high water mark, so that's the least it needs
+		if(high_water_mark)
+			event_queue.spill.reserve(std::min(high_water_mark, capacity));
+		event_queue.high_water_mark = high_water_mark;
+		event_queue.spill_limit = capacity;
+	}
+
+	void grow_spill()
+	{
+		const std::size_t wanted = std::min(event_queue.spill_wanted, event_queue.spill_limit);
+		if(event_queue.high_water_mark && wanted > event_queue.spill.capacity())
+			event_queue.spill.reserve(wanted);
+	}
+
+	void measure_queue_pressure(bool pumping) noexcept
+	{
+		if(!event_queue.tracking && !event_queue.high_water_mark)
+			return;
+
+		if(pumping)
+			SDL_PumpEvents();
+		const int depth = queue_depth();
+		if(depth < 0)
+			return;
+
+		auto& stats = event_queue.stats;
+		stats.depth = depth;
+		stats.peak_depth = std::max(stats.peak_depth, stats.depth);
+
+		if(event_queue.tracking)
+		{
+			const std::size_t pushed = event_queue.pushed.load(std::memory_order_relaxed);
+			const std::size_t accounted = event_queue.received + stats.depth;
+			stats.dropped = pushed > accounted ? pushed - accounted : 0;
+		}
+
+		if(event_queue.high_water_mark && stats.depth > event_queue.high_water_mark)
+			spill_events(stats.depth);
+	}
+
+	void check_queue_pressure() noexcept
+	{
+		measure_queue_pressure(true);
+	}
+
+	void check_queue_pressure(no_pump_t) noexcept
+	{
+		measure_queue_pressure(false);
+	}
+
+	queue_stats queue_pressure() noexcept
+	{
+		auto stats = event_queue.stats;
+		stats.spill_depth = event_queue.spill.size();
+		return stats;
+	}
+
+	void reset_queue_stats() noexcept
+	{
+		const std::size_t depth = std::max(queue_depth(), 0);
+		event_queue.stats = {};
+		event_queue.stats.depth = depth;
+		event_queue.received = 0;
+		event_queue.pushed = depth;
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,89 @@
+#ifndef SIMPLE_INTERACTIVE_QUEUE_H
+#define SIMPLE_INTERACTIVE_QUEUE_H
+#include <cstddef>
+#include <SDL2/SDL.h>
+
+namespace simple::interactive
+{
+
+	struct queue_stats
+	{
+		// as of the last check
+		std::size_t depth;
+		std::size_t peak_depth;
+		// times the spill threshold was crossed, and events moved out of SDL's queue as a result
+		std::size_t spills;
+		std::size_t spilled_events;
+		// events waiting in the spill buffer
+		std::size_t spill_depth;
+		// pushed to SDL's queue, but never made it out, only counted while tracking
+		std::size_t dropped;
+	};
+
+	// Pumping gathers events from the OS, it's the costly part of polling, and SDL_PollEvent does it on every call.
+	// The functions that take no_pump skip it, relying on an explicit pump() call instead,
+	// so that it can happen once per frame.
+	struct no_pump_t {};
+	constexpr no_pump_t no_pump{};
+
+	// also begins a new drain
+	void pump() noexcept;
+
+	// The priority lanes and the queue pressure check run once at the start of each drain.
+	// A drain ends when the queue runs empty, or a new one begins with pump(), drain_events,
+	// or this, so stopping early doesn't leave the checks off.
+	void begin_drain() noexcept;
+
+	// Blocks until there are events to take, or the timeout in milliseconds runs out (negative waits indefinitely),
+	// pumping as it waits, but doesn't take any. Returns false on timeout.
+	// For when nothing changed and there's nothing to render, instead of sleeping for a frame.
+	bool wait_for_events(int timeout = -1) noexcept;
+
+	// raw SDL event queue access, all the event functions go through this,
+	// takes events from the spill buffer first, checks queue pressure at the start of each drain
+	bool poll_event(SDL_Event&) noexcept;
+	bool poll_event(SDL_Event&, no_pump_t) noexcept;
+
+	// takes only events of a range of types out of SDL's queue, leaving the rest in place,
+	// doesn't pump or look in the spill buffer, returns the number taken
+	int take_events(SDL_Event* events, int count, uint32_t first_type, uint32_t last_type) noexcept;
+
+	// events already taken out of SDL's queue, by priority lanes or spilling,
+	// that will be delivered ahead of whatever is still in it
+	std::size_t buffered_events() noexcept;
+
+	// SDL's queue is bounded and silently drops events when full.
+	// Tracking counts the events pushed to it (with an event watch, so the event subsystem must be initialized),
+	// to compare against the ones that come out.
+	void track_queue_pressure(bool enable) noexcept;
+
+	// At the start of each drain, quit requests, and window close and focus events,
+	// are taken out of SDL's queue ahead of everything else, and delivered first,
+	// so they are not stuck behind a flood of input. Both lanes are in order on their own.
+	// Other window events (enter, leave, moved and such) keep their place among the input.
+	// The lane is allocated when enabled and never grows, whatever doesn't fit waits its turn in SDL's queue.
+	void priority_lanes(bool enable);
+
+	// When the queue holds more than high_water_mark events at a check,
+	// they are moved to a buffer owned by the library, to make room.
+	// Zero disables spilling. The buffer starts out at the size of the high water mark, and grows toward
+	// what the spills needed, up to capacity (rounded up to a power of two, the default is all of SDL's queue, SDL_MAX_QUEUED_EVENTS),
+	// but only in grow_spill(), never while taking events. Whatever doesn't fit stays in SDL's queue.
+	void spill_mode(std::size_t high_water_mark, std::size_t capacity = 65536);
+
+	// Grows the spill buffer to fit what the spills so far needed, up to the capacity given to spill_mode.
+	// drain_events and dispatch_pending do this at the start, call it when taking events one at a time.
+	void grow_spill();
+
+	// Measures queue depth, updates the stats and spills if necessary.
+	// Done at the start of each drain, can be called more often during long frames.
+	// Counting the events is linear in SDL, so it's not done on every poll.
+	void check_queue_pressure() noexcept;
+	void check_queue_pressure(no_pump_t) noexcept;
+
+	queue_stats queue_pressure() noexcept;
+	void reset_queue_stats() noexcept;
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,68 @@
+#include "readiness.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+namespace simple::interactive
+{
+
+	input_readiness::input_readiness() :
+		fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+	{
+		if(fd_ < 0)
+			throw std::system_error(errno, std::system_category(), "eventfd");
+	}
+
+	input_readiness::~input_readiness()
+	{
+		watch_sdl(false);
+		close(fd_);
+	}
+
+	int input_readiness::fd() const noexcept
+	{
+		return fd_;
+	}
+
+	void input_readiness::notify() noexcept
+	{
+		// only the first notification after a clear does a syscall
+		if(armed.exchange(false, std::memory_order_acq_rel))
+		{
+			const uint64_t one = 1;
+			[[maybe_unused]] auto result = write(fd_, &one, sizeof(one));
+		}
+	}
+
+	void input_readiness::clear() noexcept
+	{
+		uint64_t count;
+		[[maybe_unused]] auto result = read(fd_, &count, sizeof(count));
+		armed.store(true, std::memory_order_release);
+	}
+
+	int input_readiness::sdl_watch(void* readiness, SDL_Event*)
+	{
+		static_cast<input_readiness*>(readiness)->notify();
+		return 1;
+	}
+
+	void input_readiness::watch_sdl(bool enable) noexcept
+	{
+		if(enable == watching)
+			return;
+
+		watching = enable;
+		if(enable)
+			SDL_AddEventWatch(sdl_watch, this);
+		else
+			SDL_DelEventWatch(sdl_watch, this);
+	}
+
+} // namespace simple::interactive
+
+#endif
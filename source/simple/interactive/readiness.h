@@ -0,0 +1,46 @@
+#ifndef SIMPLE_INTERACTIVE_READINESS_H
+#define SIMPLE_INTERACTIVE_READINESS_H
+#include "event.h"
+
+#if defined(__linux__)
+#include <atomic>
+
+namespace simple::interactive
+{
+
+	// An eventfd that becomes readable when input is ready, to wait on in epoll (or io_uring, poll, select) along with other descriptors.
+	// It is signalled once, when going from idle to ready, and stays readable until clear() is called,
+	// which should be done before draining, so events arriving during the drain signal again.
+	class input_readiness
+	{
+		public:
+		// throws std::system_error if the eventfd can't be created
+		input_readiness();
+		input_readiness(const input_readiness&) = delete;
+		input_readiness& operator=(const input_readiness&) = delete;
+		~input_readiness();
+
+		int fd() const noexcept;
+
+		// thread safe
+		void notify() noexcept;
+		void clear() noexcept;
+
+		// Signals whenever SDL queues an event, using an event watch.
+		// SDL only queues events when pumped, so the OS events still need a pump,
+		// this is for events pushed from other threads, or timers.
+		void watch_sdl(bool enable) noexcept;
+
+		private:
+		static int sdl_watch(void*, SDL_Event*);
+
+		int fd_;
+		std::atomic<bool> armed{true};
+		bool watching = false;
+	};
+
+} // namespace simple::interactive
+
+#endif
+
+#endif /* end of include guard */
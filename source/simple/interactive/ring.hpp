@@ -0,0 +1,145 @@
+#ifndef SIMPLE_INTERACTIVE_RING_HPP
+#define SIMPLE_INTERACTIVE_RING_HPP
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+namespace simple::interactive
+{
+
+	// A FIFO over a power of two sized circular buffer, that grows when full.
+	// Elements are constructed in place, so they don't need to be assignable (events aren't).
+	template <typename T>
+	class ring
+	{
+		public:
+		using value_type = T;
+
+		ring() noexcept = default;
+
+		explicit ring(std::size_t capacity)
+		{
+			reserve(capacity);
+		}
+
+		ring(const ring&) = delete;
+		ring& operator=(const ring&) = delete;
+
+		ring(ring&& other) noexcept :
+			storage(std::move(other.storage)),
+			mask(std::exchange(other.mask, 0)),
+			head(std::exchange(other.head, 0)),
+			count(std::exchange(other.count, 0))
+		{}
+
+		ring& operator=(ring&& other) noexcept
+		{
+			clear();
+			storage = std::move(other.storage);
+			mask = std::exchange(other.mask, 0);
+			head = std::exchange(other.head, 0);
+			count = std::exchange(other.count, 0);
+			return *this;
+		}
+
+		~ring() { clear(); }
+
+		std::size_t size() const noexcept { return count; }
+		bool empty() const noexcept { return count == 0; }
+		bool full() const noexcept { return count == capacity(); }
+		std::size_t capacity() const noexcept { return storage ? mask + 1 : 0; }
+
+		// index 0 is the oldest element
+		T& operator[](std::size_t index) noexcept { return *slot(head + index); }
+		const T& operator[](std::size_t index) const noexcept { return *slot(head + index); }
+
+		T& front() noexcept { return (*this)[0]; }
+		const T& front() const noexcept { return (*this)[0]; }
+		T& back() noexcept { return (*this)[count - 1]; }
+		const T& back() const noexcept { return (*this)[count - 1]; }
+
+		template <typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if(full())
+				reserve(capacity() ? capacity() * 2 : 16);
+			T* element = new (raw(head + count)) T(std::forward<Args>(args)...);
+			++count;
+			return *element;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		// same as emplace_back, but makes room by dropping the oldest element, instead of growing
+		template <typename... Args>
+		T& emplace_back_overwrite(Args&&... args)
+		{
+			if(full())
+				pop_front();
+			return emplace_back(std::forward<Args>(args)...);
+		}
+
+		void pop_front() noexcept
+		{
+			slot(head)->~T();
+			head = (head + 1) & mask;
+			--count;
+		}
+
+		void clear() noexcept
+		{
+			while(!empty())
+				pop_front();
+			head = 0;
+		}
+
+		void reserve(std::size_t new_capacity)
+		{
+			if(new_capacity <= capacity())
+				return;
+
+			std::size_t size = 1;
+			while(size < new_capacity)
+				size *= 2;
+
+			auto new_storage = std::make_unique<cell[]>(size);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				new (&new_storage[i]) T(std::move((*this)[i]));
+				slot(head + i)->~T();
+			}
+			storage = std::move(new_storage);
+			mask = size - 1;
+			head = 0;
+		}
+
+		private:
+		using cell = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+		void* raw(std::size_t index) noexcept
+		{
+			return &storage[index & mask];
+		}
+
+		T* slot(std::size_t index) noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(&storage[index & mask]));
+		}
+
+		const T* slot(std::size_t index) const noexcept
+		{
+			return std::launder(reinterpret_cast<const T*>(&storage[index & mask]));
+		}
+
+		std::unique_ptr<cell[]> storage;
+		std::size_t mask = 0;
+		std::size_t head = 0;
+		std::size_t count = 0;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,49 @@
+#include "router.h"
+
+namespace simple::interactive
+{
+
+	void window_router::route(uint32_t window_id, handler handle, void* context)
+	{
+		// not a window, that's what the fallback is for
+		if(window_id == 0)
+			return;
+		if(window_id >= windows.size())
+			windows.resize(window_id + 1);
+		windows[window_id] = {handle, context};
+	}
+
+	void window_router::unroute(uint32_t window_id) noexcept
+	{
+		if(window_id < windows.size())
+			windows[window_id] = {};
+		while(!windows.empty() && !windows.back().handle)
+			windows.pop_back();
+	}
+
+	bool window_router::routed(uint32_t window_id) const noexcept
+	{
+		return window_id < windows.size() && windows[window_id].handle;
+	}
+
+	void window_router::fallback(handler handle, void* context) noexcept
+	{
+		fallback_ = {handle, context};
+	}
+
+	bool window_router::dispatch(const event& e)
+	{
+		// zero is never routed, so no window means no entry
+		const auto id = window_id(e);
+		if(id < windows.size() && windows[id].handle)
+		{
+			windows[id].handle(windows[id].context, e);
+			return true;
+		}
+
+		if(fallback_.handle)
+			fallback_.handle(fallback_.context, e);
+		return false;
+	}
+
+} // namespace simple::interactive
@@ -0,0 +1,72 @@
+#ifndef SIMPLE_INTERACTIVE_ROUTER_H
+#define SIMPLE_INTERACTIVE_ROUTER_H
+#include <vector>
+#include <memory>
+#include "event.h"
+
+namespace simple::interactive
+{
+
+	// Delivers each event straight to the handler of its window.
+	// Window ids are small and handed out in sequence, so the table is indexed by them directly,
+	// an event costs one lookup no matter how many windows there are.
+	// Events with no window (pointer, quit), with a window id of zero (SDL sends those before anything gets focus),
+	// or with a window nobody routed go to the fallback.
+	class window_router
+	{
+		public:
+		using handler = void (*)(void* context, const event&);
+
+		void route(uint32_t window_id, handler, void* context = nullptr);
+
+		// the callable is referenced, not copied, and must outlive the route
+		template <typename Handler>
+		void route(uint32_t window_id, Handler& handle)
+		{
+			route(window_id, call<Handler>, std::addressof(handle));
+		}
+
+		void unroute(uint32_t window_id) noexcept;
+		bool routed(uint32_t window_id) const noexcept;
+
+		void fallback(handler, void* context = nullptr) noexcept;
+
+		template <typename Handler>
+		void fallback(Handler& handle) noexcept
+		{
+			fallback(call<Handler>, std::addressof(handle));
+		}
+
+		// returns false if the event went to the fallback
+		bool dispatch(const event&);
+
+		// returns the number of events that went to a window
+		template <typename Events>
+		std::size_t dispatch(const Events& events)
+		{
+			std::size_t count = 0;
+			for(auto&& e : events)
+				count += dispatch(e);
+			return count;
+		}
+
+		private:
+		struct entry
+		{
+			handler handle = nullptr;
+			void* context = nullptr;
+		};
+
+		template <typename Handler>
+		static void call(void* context, const event& e)
+		{
+			(*static_cast<Handler*>(context))(e);
+		}
+
+		std::vector<entry> windows;
+		entry fallback_;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
@@ -0,0 +1,163 @@
+#ifndef SIMPLE_INTERACTIVE_TIMER_WHEEL_HPP
+#define SIMPLE_INTERACTIVE_TIMER_WHEEL_HPP
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace simple::interactive
+{
+
+	// Hierarchical timing wheel for a fixed set of timers, identified by index.
+	// Scheduling and canceling are constant time, advancing is constant time per tick,
+	// no matter how many timers are pending, timers further out get cascaded to finer levels as time comes.
+	class timer_wheel
+	{
+		public:
+		static constexpr std::size_t levels = 4;
+		static constexpr std::size_t slot_bits = 6;
+		static constexpr std::size_t slots = std::size_t(1) << slot_bits;
+		static constexpr uint64_t slot_mask = slots - 1;
+		static constexpr uint64_t max_delta = (uint64_t(1) << (levels * slot_bits)) - 1;
+
+		explicit timer_wheel(std::size_t timers, uint64_t now = 0) :
+			nodes(timers + levels * slots),
+			timers(timers),
+			current(now)
+		{
+			for(std::size_t head = timers; head < nodes.size(); ++head)
+				nodes[head].prev = nodes[head].next = head;
+		}
+
+		uint64_t now() const noexcept { return current; }
+		std::size_t size() const noexcept { return timers; }
+		std::size_t pending() const noexcept { return pending_; }
+
+		bool scheduled(std::size_t id) const noexcept { return nodes[id].linked; }
+
+		// a tick that is already past expires on the next one
+		void schedule(std::size_t id, uint64_t tick) noexcept
+		{
+			cancel(id);
+			nodes[id].expiry = std::max(tick, current + 1);
+			place(id);
+			++pending_;
+		}
+
+		void cancel(std::size_t id) noexcept
+		{
+			if(!nodes[id].linked)
+				return;
+			unlink(id);
+			--pending_;
+		}
+
+		// calls expired(id, expiry) for every timer due up to and including the tick,
+		// timers can be rescheduled from the callback
+		template <typename Expired>
+		void advance(uint64_t tick, Expired&& expired)
+		{
+			while(current < tick)
+			{
+				if(pending_ == 0)
+				{
+					current = tick;
+					break;
+				}
+
+				++current;
+
+				// when a level wraps around, the next slot of the level above is due to be spread out
+				for(std::size_t level = 1; level < levels; ++level)
+				{
+					if(((current >> ((level - 1) * slot_bits)) & slot_mask) != 0)
+						break;
+					cascade(head(level, (current >> (level * slot_bits)) & slot_mask));
+				}
+
+				const std::size_t due = head(0, current & slot_mask);
+				while(nodes[due].next != due)
+				{
+					const std::size_t id = nodes[due].next;
+					unlink(id);
+					if(nodes[id].expiry > current) // was too far to fit
+					{
+						place(id);
+						continue;
+					}
+					--pending_;
+					expired(id, nodes[id].expiry);
+				}
+			}
+		}
+
+		private:
+		struct node
+		{
+			std::size_t prev = 0;
+			std::size_t next = 0;
+			uint64_t expiry = 0;
+			bool linked = false;
+		};
+
+		std::size_t head(std::size_t level, uint64_t slot) const noexcept
+		{
+			return timers + level * slots + slot;
+		}
+
+		void place(std::size_t id) noexcept
+		{
+			const uint64_t when = std::min(nodes[id].expiry, current + max_delta);
+			const uint64_t delta = when - current;
+			std::size_t level = 0;
+			while(level < levels - 1 && delta >= (uint64_t(1) << ((level + 1) * slot_bits)))
+				++level;
+			link(id, head(level, (when >> (level * slot_bits)) & slot_mask));
+		}
+
+		void cascade(std::size_t list) noexcept
+		{
+			if(nodes[list].next == list)
+				return;
+
+			// detach first, placing can put timers back in the same list
+			std::size_t id = nodes[list].next;
+			nodes[nodes[list].prev].next = std::size_t(-1);
+			nodes[list].prev = nodes[list].next = list;
+			while(id != std::size_t(-1))
+			{
+				const std::size_t next = nodes[id].next;
+				nodes[id].linked = false;
+				place(id);
+				id = next;
+			}
+		}
+
+		void link(std::size_t id, std::size_t list) noexcept
+		{
+			auto& item = nodes[id];
+			item.prev = nodes[list].prev;
+			item.next = list;
+			nodes[item.prev].next = id;
+			nodes[list].prev = id;
+			item.linked = true;
+		}
+
+		void unlink(std::size_t id) noexcept
+		{
+			auto& item = nodes[id];
+			nodes[item.prev].next = item.next;
+			nodes[item.next].prev = item.prev;
+			item.linked = false;
+		}
+
+		// timer nodes first, then list heads
+		std::vector<node> nodes;
+		std::size_t timers;
+		uint64_t current;
+		std::size_t pending_ = 0;
+	};
+
+} // namespace simple::interactive
+
+#endif /* end of include guard */
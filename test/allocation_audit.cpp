@@ -0,0 +1,300 @@
+#include <cstdio>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <stdexcept>
+
+// the audit is built in here, so this doesn't depend on how the library was built
+#define SIMPLE_INTERACTIVE_ALLOCATION_AUDIT
+#include "simple/interactive/allocation_audit.cpp"
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/await.h"
+#include "simple/interactive/broadcast_ring.hpp"
+#include "simple/interactive/changes.h"
+#include "simple/interactive/coalesce.h"
+#include "simple/interactive/event.h"
+#include "simple/interactive/event_history.h"
+#include "simple/interactive/event_ref.h"
+#include "simple/interactive/frame_arena.h"
+#include "simple/interactive/key_repeat.h"
+#include "simple/interactive/late_latch.h"
+#include "simple/interactive/motion.h"
+#include "simple/interactive/motion_history.h"
+#include "simple/interactive/mouse_state.h"
+#include "simple/interactive/normalize.h"
+#include "simple/interactive/queue.h"
+#include "simple/interactive/router.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "simple/interactive/evdev.h"
+#include "simple/interactive/input_stream.h"
+#include "simple/interactive/readiness.h"
+#endif
+
+// Runs every type of event through every part of the event path inside an allocation_free section,
+// after a warm up round, and fails if anything allocates.
+// Whatever is added to the event path gets a stage in pipeline::run here.
+// Only the global allocation functions are counted, SDL allocates with malloc (SDL_malloc),
+// so whatever it does inside pump and its queue is not.
+
+using namespace simple::interactive;
+
+std::size_t push_all_types(Uint32 window_id)
+{
+	std::vector<SDL_Event> events;
+
+	auto add = [&events, window_id](Uint32 type)
+	{
+		SDL_Event event{};
+		event.type = type;
+		// window id is at the same place in all the events that have one
+		event.window.windowID = window_id;
+		events.push_back(event);
+		return &events.back();
+	};
+
+	// leading motion, for the late latch
+	add(SDL_MOUSEMOTION)->motion.xrel = 1;
+	add(SDL_KEYDOWN)->key.keysym.scancode = SDL_SCANCODE_A;
+	add(SDL_KEYUP)->key.keysym.scancode = SDL_SCANCODE_A;
+	add(SDL_MOUSEBUTTONDOWN)->button.button = SDL_BUTTON_LEFT;
+	add(SDL_MOUSEBUTTONUP)->button.button = SDL_BUTTON_LEFT;
+	add(SDL_MOUSEMOTION)->motion.xrel = 1;
+	add(SDL_MOUSEWHEEL)->wheel.y = 1;
+	std::strcpy(add(SDL_TEXTINPUT)->text.text, "a");
+	std::strcpy(add(SDL_TEXTEDITING)->edit.text, "a");
+	add(SDL_FINGERDOWN)->tfinger.fingerId = 1;
+	add(SDL_FINGERMOTION)->tfinger.fingerId = 1;
+	add(SDL_FINGERUP)->tfinger.fingerId = 1;
+	add(SDL_QUIT);
+	for(auto window_event : {
+		SDL_WINDOWEVENT_SHOWN, SDL_WINDOWEVENT_HIDDEN, SDL_WINDOWEVENT_EXPOSED,
+		SDL_WINDOWEVENT_MOVED, SDL_WINDOWEVENT_RESIZED, SDL_WINDOWEVENT_SIZE_CHANGED,
+		SDL_WINDOWEVENT_MINIMIZED, SDL_WINDOWEVENT_MAXIMIZED, SDL_WINDOWEVENT_RESTORED,
+		SDL_WINDOWEVENT_ENTER, SDL_WINDOWEVENT_LEAVE,
+		SDL_WINDOWEVENT_FOCUS_GAINED, SDL_WINDOWEVENT_FOCUS_LOST, SDL_WINDOWEVENT_CLOSE })
+		add(SDL_WINDOWEVENT)->window.event = window_event;
+#if SDL_VERSION_ATLEAST(2,0,5)
+	add(SDL_WINDOWEVENT)->window.event = SDL_WINDOWEVENT_TAKE_FOCUS;
+	add(SDL_WINDOWEVENT)->window.event = SDL_WINDOWEVENT_HIT_TEST;
+#endif
+
+	for(auto& event : events)
+		SDL_PushEvent(&event);
+	return events.size();
+}
+
+#if defined(__linux__)
+// a key press, some relative motion, and the release, as a device would report them
+void write_evdev_records(int fd)
+{
+	const input_event records[] =
+	{
+		{{}, EV_KEY, KEY_A, 1}, {{}, EV_SYN, SYN_REPORT, 0},
+		{{}, EV_REL, REL_X, 3}, {{}, EV_REL, REL_Y, -2}, {{}, EV_SYN, SYN_REPORT, 0},
+		{{}, EV_KEY, KEY_A, 0}, {{}, EV_SYN, SYN_REPORT, 0},
+	};
+	if(write(fd, records, sizeof(records)) != sizeof(records))
+		std::perror("ERROR");
+}
+#endif
+
+struct pipeline
+{
+	std::vector<event> events;
+	std::vector<event> repeated;
+	std::vector<mouse_motion_data> motions;
+	std::array<float2, 256> normalized;
+	std::array<bool, 256> normalized_valid;
+	mouse_state_table mice;
+	motion_accumulator motion;
+	motion_histories<64> histories;
+	key_repeater repeater;
+	window_coalescer coalescer;
+	event_waiters waiters;
+	event_history history{256};
+	late_latch latch;
+	int2 cursor;
+	float2 accumulated_motion;
+	window_router router;
+	std::size_t routed = 0;
+	std::size_t fallen_back = 0;
+	change_tracker changes;
+	broadcast_ring<event> ring{64, 2};
+	frame_arena arena;
+	std::size_t handled = 0;
+
+#if defined(__linux__)
+	int evdev_pipe[2];
+	int stream[2];
+	std::optional<evdev_source> evdev;
+	std::optional<input_sender> sender;
+	std::optional<input_receiver> receiver;
+	input_readiness readiness;
+#endif
+
+	pipeline(uint32_t window_id)
+	{
+		events.reserve(256);
+		repeated.reserve(256);
+		motions.reserve(normalized.size());
+		latch.cursor(cursor, window_id);
+		latch.motion(accumulated_motion);
+
+		router.route(window_id, [](void* context, const event&) { ++static_cast<pipeline*>(context)->routed; }, this);
+		router.fallback([](void* context, const event&) { ++static_cast<pipeline*>(context)->fallen_back; }, this);
+
+#if defined(__linux__)
+		if(pipe2(evdev_pipe, O_NONBLOCK) != 0 || socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, stream) != 0)
+			throw std::runtime_error("no pipes");
+		evdev.emplace(evdev_pipe[0], 7);
+		sender.emplace(stream[0]);
+		receiver.emplace(stream[1]);
+#endif
+	}
+
+	~pipeline()
+	{
+#if defined(__linux__)
+		for(int fd : {evdev_pipe[0], evdev_pipe[1], stream[0], stream[1]})
+			close(fd);
+#endif
+	}
+
+	// the events pushed for one round, three times over, one batch for each way to drain
+	void run(std::size_t batch)
+	{
+		events.clear();
+		repeated.clear();
+		motions.clear();
+
+		pump();
+
+		// raw, without translating
+		latch.latch(no_pump);
+		latch.take_latched(events);
+		for(std::size_t i = 0; i < batch; ++i)
+			if(auto ref = next_event_ref(no_pump))
+				if(auto e = ref->to_event())
+					events.push_back(*e);
+
+		// the frame arena
+		{
+			auto arena_events = drain_events(arena, no_pump);
+			coalescer.coalesce(arena_events);
+			changes.update(arena_events);
+		}
+
+		// the usual
+		drain_events(events, no_pump);
+
+#if defined(__linux__)
+		readiness.notify();
+		readiness.clear();
+		while(auto e = evdev->next_event())
+			events.push_back(*e);
+#endif
+
+		coalescer.coalesce(events);
+		repeater.process(events, [this](const event& e) { repeated.push_back(e); });
+
+#if defined(__linux__)
+		// over the wire and back
+		sender->send(repeated);
+		sender->flush();
+		receiver->drain_events(repeated);
+#endif
+
+		mice.update(repeated);
+		motion.feed(repeated);
+		histories.feed(repeated);
+		history.record(repeated);
+		waiters.dispatch(repeated);
+		router.dispatch(repeated);
+		changes.update(repeated);
+		changes.dirty_windows();
+		changes.clear();
+
+		for(auto& e : repeated)
+		{
+			ring.publish_or_drop(e);
+			if(auto m = std::get_if<mouse_motion>(&e); m && motions.size() < normalized.size())
+				motions.push_back(m->data);
+		}
+		for(std::size_t consumer = 0; consumer < ring.consumer_count(); ++consumer)
+			ring.consume(consumer, [](const event&) {});
+
+		window_normalized_positions(motions.data(), motions.size(), normalized.data(), normalized_valid.data());
+
+		arena.reset();
+		handled += repeated.size();
+	}
+};
+
+std::size_t failures = 0;
+
+int main() try
+{
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", false);
+
+	initializer init;
+	simple::sdlcore::initializer video(simple::sdlcore::system_flag::video);
+	SDL_Window* window = SDL_CreateWindow("allocation audit", 0,0, 64,64, SDL_WINDOW_HIDDEN);
+	if(!window)
+		throw std::runtime_error(SDL_GetError());
+	const Uint32 window_id = SDL_GetWindowID(window);
+
+	allocation_audit_handler([](std::size_t size)
+	{
+		std::printf("allocated %zu bytes\n", size);
+		++failures;
+	});
+
+	track_queue_pressure(true);
+	priority_lanes(true);
+	spill_mode(1024);
+
+	pipeline input(window_id);
+
+	auto push_round = [&]()
+	{
+		std::size_t batch = push_all_types(window_id);
+		push_all_types(window_id);
+		push_all_types(window_id);
+#if defined(__linux__)
+		write_evdev_records(input.evdev_pipe[1]);
+#endif
+		return batch;
+	};
+
+	// warm up, everything grows to the size it needs
+	for(int round = 0; round < 2; ++round)
+		input.run(push_round());
+
+	for(int round = 0; round < 100; ++round)
+	{
+		const std::size_t batch = push_round();
+		allocation_free section;
+		input.run(batch);
+	}
+
+	SDL_DestroyWindow(window);
+	std::printf("%zu events handled, %zu routed, %zu allocations\n",
+		input.handled, input.routed, audited_allocations());
+	return failures == 0 && input.routed != 0 ? 0 : 1;
+}
+catch(...)
+{
+	if(errno)
+		std::perror("ERROR");
+
+	const char* sdl_error = SDL_GetError();
+	if(*sdl_error)
+		std::puts(sdl_error);
+
+	throw;
+}
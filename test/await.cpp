@@ -0,0 +1,141 @@
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/await.h"
+
+// Waiters are notified once, only by events of their type, and can wait again from the notification.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+const event key{key_pressed{{make_event_data(1ms), 1, keycode::a, scancode::a, keystate::pressed, 0}}};
+const event click{mouse_up{make_event_data(2ms), 1, 0, int2::zero(), mouse_button::left, keystate::released, 1}};
+const event quit{quit_request{make_event_data(3ms)}};
+
+struct counting_waiter : event_waiter
+{
+	int count = 0;
+	bool again = false;
+	event_waiters* waiters = nullptr;
+
+	counting_waiter()
+	{
+		notify = [](event_waiter& waiter, const event& e)
+		{
+			auto& self = static_cast<counting_waiter&>(waiter);
+			assert(!self.linked());
+			assert(std::holds_alternative<key_pressed>(e));
+			++self.count;
+			if(self.again)
+				self.waiters->wait<key_pressed>(self);
+		};
+	}
+};
+
+#if defined(SIMPLE_INTERACTIVE_COROUTINES)
+std::vector<int> trace;
+
+input_task script(event_waiters& input)
+{
+	const auto pressed = co_await input.next<key_pressed>();
+	trace.push_back(int(pressed.data.scancode));
+	const auto either = co_await input.any_of<mouse_up, quit_request>();
+	trace.push_back(int(either.index()));
+	const auto again = co_await input.any_of<mouse_up, quit_request>();
+	trace.push_back(int(again.index()));
+}
+#endif
+
+int main()
+{
+	event_waiters waiters;
+	for(std::size_t type = 0; type < std::variant_size_v<event>; ++type)
+		assert(!waiters.waiting(type));
+
+	// once
+	{
+		counting_waiter waiter;
+		waiters.wait<key_pressed>(waiter);
+		assert(waiter.linked());
+		assert(waiters.waiting(event_index<key_pressed>));
+
+		assert(waiters.dispatch(click) == 0);
+		assert(waiters.dispatch(quit) == 0);
+		assert(waiter.count == 0);
+
+		assert(waiters.dispatch(key) == 1);
+		assert(waiter.count == 1);
+		assert(!waiter.linked());
+		assert(!waiters.waiting(event_index<key_pressed>));
+
+		assert(waiters.dispatch(key) == 0);
+		assert(waiter.count == 1);
+	}
+
+	// waiting again from the notification waits for the next event, not the current one
+	{
+		counting_waiter first, second;
+		first.waiters = second.waiters = &waiters;
+		first.again = second.again = true;
+		waiters.wait<key_pressed>(first);
+		waiters.wait<key_pressed>(second);
+
+		const event events[] = {key, click, key};
+		assert(waiters.dispatch(events) == 4);
+		assert(first.count == 2 && second.count == 2);
+
+		first.unlink();
+		assert(!first.linked());
+		assert(waiters.dispatch(key) == 1);
+		assert(first.count == 2 && second.count == 3);
+	}
+	// destroyed waiters unlink themselves
+	assert(!waiters.waiting(event_index<key_pressed>));
+	assert(waiters.dispatch(key) == 0);
+
+	// from the queue
+	{
+		initializer init;
+		counting_waiter waiter;
+		waiters.wait<key_pressed>(waiter);
+
+		SDL_Event raw{};
+		raw.type = SDL_MOUSEBUTTONUP;
+		SDL_PushEvent(&raw);
+		raw.type = SDL_KEYDOWN;
+		SDL_PushEvent(&raw);
+		assert(waiters.dispatch_pending() == 1);
+		assert(waiter.count == 1);
+	}
+
+#if defined(SIMPLE_INTERACTIVE_COROUTINES)
+	{
+		auto task = script(waiters);
+		assert(!task.done());
+		assert(waiters.waiting(event_index<key_pressed>));
+
+		waiters.dispatch(click);
+		assert(trace.empty());
+		waiters.dispatch(key);
+		assert(trace.size() == 1 && trace[0] == int(scancode::a));
+		assert(waiters.waiting(event_index<mouse_up>));
+		assert(waiters.waiting(event_index<quit_request>));
+
+		// the first one to come unlinks the rest
+		waiters.dispatch(quit);
+		assert(trace.size() == 2 && trace[1] == int(event_index<quit_request>));
+		waiters.dispatch(key);
+		waiters.dispatch(click);
+		assert(trace.size() == 3 && trace[2] == int(event_index<mouse_up>));
+		assert(task.done());
+		assert(!waiters.waiting(event_index<mouse_up>));
+		assert(!waiters.waiting(event_index<quit_request>));
+	}
+	std::puts("waiters and coroutines notified");
+#else
+	std::puts("waiters notified");
+#endif
+	return 0;
+}
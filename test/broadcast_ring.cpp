@@ -0,0 +1,185 @@
+#include <cassert>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "simple/interactive/broadcast_ring.hpp"
+
+// Every consumer reads every element in order, unless lapped, then what it missed is counted for it alone,
+// and what it got plus what it missed is everything. Elements are constructed and destroyed once.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+struct counted
+{
+	static inline int alive = 0;
+	uint64_t value;
+	explicit counted(uint64_t value) : value(value) { ++alive; }
+	counted(const counted& other) : value(other.value) { ++alive; }
+	~counted() { --alive; }
+};
+
+// reads on its own thread, checks the order, sleeps every so often to fall behind
+struct consumer
+{
+	broadcast_ring<uint64_t>& ring;
+	std::size_t index;
+	int pause_every;
+	std::atomic<bool>& done;
+	std::size_t got = 0;
+	std::thread thread;
+
+	consumer(broadcast_ring<uint64_t>& ring, std::size_t index, int pause_every, std::atomic<bool>& done) :
+		ring(ring), index(index), pause_every(pause_every), done(done),
+		thread([this]() { run(); })
+	{}
+
+	void run()
+	{
+		uint64_t last = 0;
+		bool first = true;
+		while(true)
+		{
+			const bool finished = done.load(std::memory_order_acquire);
+			got += ring.consume(index, [&](uint64_t value)
+			{
+				assert(first || value > last);
+				first = false;
+				last = value;
+				if(pause_every && value % pause_every == 0)
+					std::this_thread::sleep_for(10us);
+			});
+			if(finished && ring.available(index) == 0)
+				break;
+			std::this_thread::yield();
+		}
+	}
+};
+
+void threaded(bool drop)
+{
+	constexpr uint64_t count = 200000;
+	broadcast_ring<uint64_t> ring(256, 3);
+	std::atomic<bool> done{false};
+	// the first one never pauses
+	std::vector<std::unique_ptr<consumer>> consumers;
+	for(std::size_t i = 0; i < ring.consumer_count(); ++i)
+		consumers.push_back(std::make_unique<consumer>(ring, i, i * 500, done));
+
+	std::size_t lapped = 0;
+	for(uint64_t value = 0; value < count; ++value)
+	{
+		if(drop)
+			lapped += ring.publish_or_drop(value);
+		else
+			ring.publish(value);
+	}
+	done.store(true, std::memory_order_release);
+
+	for(auto& reader : consumers)
+		reader->thread.join();
+
+	for(std::size_t i = 0; i < ring.consumer_count(); ++i)
+	{
+		assert(consumers[i]->got + ring.dropped(i) == count);
+		if(!drop)
+			assert(ring.dropped(i) == 0);
+	}
+	assert(ring.dropped() == lapped);
+	(void)lapped;
+}
+
+int main()
+{
+	{
+		broadcast_ring<int> ring(5, 1);
+		assert(ring.capacity() == 8);
+		assert(ring.consumer_count() == 1);
+		assert(ring.available(0) == 0);
+
+		// full
+		for(int i = 0; i < 8; ++i)
+			assert(ring.try_publish(i));
+		assert(!ring.try_publish(8));
+		assert(ring.available(0) == 8);
+
+		// in place, by offset
+		for(int i = 0; i < 8; ++i)
+			assert(ring.peek(0, i) == i);
+		ring.release(0, 3);
+		assert(ring.available(0) == 5);
+		assert(ring.peek(0) == 3);
+		assert(ring.try_publish(8));
+
+		std::vector<int> read;
+		assert(ring.consume(0, [&read](int value) { read.push_back(value); }) == 6);
+		assert(read == (std::vector<int>{3,4,5,6,7,8}));
+		assert(ring.available(0) == 0);
+		assert(ring.consume(0, [](int) { assert(false); }) == 0);
+	}
+
+	// lapping
+	{
+		broadcast_ring<counted> ring(4, 2);
+		for(uint64_t i = 0; i < 4; ++i)
+			assert(ring.publish_or_drop(i) == 0);
+
+		// one keeps up, the other never reads
+		std::vector<uint64_t> reader;
+		const auto read = [&reader](const counted& c) { reader.push_back(c.value); };
+		for(uint64_t i = 4; i < 10; ++i)
+		{
+			ring.consume(0, read);
+			assert(ring.publish_or_drop(i) == 1);
+		}
+		assert(counted::alive == 4);
+
+		assert(ring.dropped(0) == 0);
+		assert(ring.dropped(1) == 6);
+		assert(ring.dropped() == 6);
+		assert(ring.available(1) == 4);
+
+		// the newest ones
+		std::vector<uint64_t> lapped;
+		ring.consume(1, [&lapped](const counted& c) { lapped.push_back(c.value); });
+		assert(lapped == (std::vector<uint64_t>{6,7,8,9}));
+
+		// the other one was never behind
+		ring.consume(0, read);
+		assert(reader == (std::vector<uint64_t>{0,1,2,3,4,5,6,7,8,9}));
+
+		// both caught up, nobody is lapped
+		for(uint64_t i = 10; i < 14; ++i)
+			assert(ring.publish_or_drop(i) == 0);
+		assert(ring.dropped() == 6);
+
+		// a reading consumer isn't lapped until it's done with the element
+		{
+			std::atomic<bool> published{false};
+			std::thread producer;
+			{
+				const auto guard = ring.reading(1);
+				assert(ring.peek(1).value == 10);
+				producer = std::thread([&]() { ring.publish_or_drop(counted(14)); published = true; });
+				std::this_thread::sleep_for(10ms);
+				assert(!published);
+				assert(ring.peek(1).value == 10);
+			}
+			producer.join();
+			assert(published);
+			assert(ring.dropped(1) == 7);
+			assert(ring.peek(1).value == 11);
+		}
+	}
+	assert(counted::alive == 0);
+
+	threaded(false);
+	threaded(true);
+
+	std::puts("broadcast in order");
+	return 0;
+}
@@ -0,0 +1,197 @@
+#include <cassert>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/coalesce.h"
+
+// Only the last move, resize and size change of each window survive, in place,
+// and nothing is coalesced across a barrier. Random batches are checked against the definition.
+
+using namespace simple::interactive;
+
+// each event is tagged with its position in the batch, as its timestamp
+template <typename Event>
+event window_vector_event(int tag, uint32_t window_id)
+{
+	return Event{{make_event_data(std::chrono::milliseconds(tag)), window_id, int2(tag, tag)}};
+}
+
+template <typename Event>
+event window_event(int tag, uint32_t window_id)
+{
+	return Event{{make_event_data(std::chrono::milliseconds(tag)), window_id}};
+}
+
+event quit(int tag)
+{
+	return quit_request{make_event_data(std::chrono::milliseconds(tag))};
+}
+
+event key(int tag)
+{
+	return key_pressed{{make_event_data(std::chrono::milliseconds(tag)), 1, keycode::a, scancode::a, keystate::pressed, 0}};
+}
+
+using maker = event (*)(int tag, uint32_t window_id);
+const maker coalescable[] =
+{
+	window_vector_event<window_moved>,
+	window_vector_event<window_resized>,
+	window_vector_event<window_size_changed>,
+};
+const maker barriers[] =
+{
+	[](int tag, uint32_t) { return quit(tag); },
+	window_event<window_focus_gained>,
+	window_event<window_focus_lost>,
+	window_event<window_closed>,
+#if SDL_VERSION_ATLEAST(2,0,5)
+	window_event<window_take_focus>,
+#endif
+};
+const maker others[] =
+{
+	[](int tag, uint32_t) { return key(tag); },
+	window_event<window_exposed>,
+	window_event<window_shown>,
+	window_event<window_entered>,
+	window_event<window_left>,
+	window_event<window_minimized>,
+	window_event<window_restored>,
+};
+
+template <typename Events>
+std::vector<int> tags(const Events& events)
+{
+	std::vector<int> result;
+	for(auto& e : events)
+		result.push_back(int(timestamp(e).count()));
+	return result;
+}
+
+bool is_barrier(const event& e)
+{
+	for(auto make : barriers)
+		if(make(0, 0).index() == e.index())
+			return true;
+	return false;
+}
+
+// straight from the definition, an event goes if a later one of the same kind and window comes before any barrier
+std::vector<int> expected(const std::vector<event>& events)
+{
+	std::vector<int> result;
+	for(std::size_t i = 0; i < events.size(); ++i)
+	{
+		bool replaced = false;
+		if(auto data = window_id(events[i]); data && !is_barrier(events[i]))
+		{
+			const bool is_coalescable = std::holds_alternative<window_moved>(events[i])
+				|| std::holds_alternative<window_resized>(events[i])
+				|| std::holds_alternative<window_size_changed>(events[i]);
+			for(std::size_t j = i + 1; is_coalescable && j < events.size() && !is_barrier(events[j]); ++j)
+				if(events[j].index() == events[i].index() && window_id(events[j]) == data)
+					replaced = true;
+		}
+		if(!replaced)
+			result.push_back(int(timestamp(events[i]).count()));
+	}
+	return result;
+}
+
+int main()
+{
+	window_coalescer coalescer;
+
+	// a storm, with other events in between
+	{
+		std::vector<event> events;
+		int tag = 0;
+		events.push_back(window_vector_event<window_moved>(tag++, 1));
+		events.push_back(window_vector_event<window_resized>(tag++, 1));
+		events.push_back(key(tag++));
+		events.push_back(window_vector_event<window_moved>(tag++, 2));
+		events.push_back(window_vector_event<window_moved>(tag++, 1));
+		events.push_back(window_event<window_exposed>(tag++, 1));
+		events.push_back(window_vector_event<window_resized>(tag++, 1));
+		events.push_back(window_vector_event<window_size_changed>(tag++, 1));
+		events.push_back(window_vector_event<window_moved>(tag++, 1));
+		events.push_back(window_vector_event<window_moved>(tag++, 2));
+
+		assert(coalescer.coalesce(events) == 4);
+		assert(tags(events) == (std::vector<int>{2, 5, 6, 7, 8, 9}));
+		// the survivors carry their own values
+		assert(std::get<window_moved>(events[4]).data.value == int2(8,8));
+	}
+
+	// every barrier splits the storm
+	for(auto barrier : barriers)
+	{
+		std::vector<event> events;
+		events.push_back(window_vector_event<window_moved>(0, 1));
+		events.push_back(window_vector_event<window_moved>(1, 1));
+		events.push_back(barrier(2, 1));
+		events.push_back(window_vector_event<window_moved>(3, 1));
+		events.push_back(window_vector_event<window_moved>(4, 1));
+		assert(coalescer.coalesce(events) == 2);
+		assert(tags(events) == (std::vector<int>{1, 2, 4}));
+	}
+
+	// a barrier for one window is a barrier for all
+	{
+		std::vector<event> events;
+		events.push_back(window_vector_event<window_resized>(0, 2));
+		events.push_back(window_event<window_focus_lost>(1, 1));
+		events.push_back(window_vector_event<window_resized>(2, 2));
+		assert(coalescer.coalesce(events) == 0);
+		assert(tags(events) == (std::vector<int>{0, 1, 2}));
+	}
+
+	// other events don't get in the way
+	for(auto other : others)
+	{
+		std::vector<event> events;
+		events.push_back(window_vector_event<window_size_changed>(0, 1));
+		events.push_back(other(1, 1));
+		events.push_back(window_vector_event<window_size_changed>(2, 1));
+		assert(coalescer.coalesce(events) == 1);
+		assert(tags(events) == (std::vector<int>{1, 2}));
+	}
+
+	// random batches, in a vector and in an arena
+	std::mt19937 random(5);
+	frame_arena arena;
+	for(int round = 0; round < 2000; ++round, arena.reset())
+	{
+		std::vector<event> events;
+		arena_vector<event> arena_events(arena);
+		const int count = random() % 64;
+		for(int tag = 0; tag < count; ++tag)
+		{
+			const uint32_t window = random() % 3 + 1;
+			const auto kind = random() % 10;
+			const auto make =
+				kind < 6 ? coalescable[random() % std::size(coalescable)] :
+				kind < 7 ? barriers[random() % std::size(barriers)] :
+				others[random() % std::size(others)];
+			events.push_back(make(tag, window));
+			arena_events.push_back(events.back());
+		}
+
+		const auto want = expected(events);
+		const std::size_t removed = coalescer.coalesce(events);
+		assert(tags(events) == want);
+		assert(removed == std::size_t(count) - want.size());
+
+		assert(coalescer.coalesce(arena_events) == removed);
+		assert(tags(arena_events) == want);
+		assert(arena_events.get_allocator() == arena_allocator<event>(arena));
+
+		// nothing left to do the second time
+		assert(coalescer.coalesce(events) == 0);
+	}
+
+	std::puts("storms coalesced");
+	return 0;
+}
@@ -0,0 +1,207 @@
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "simple/interactive/evdev.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+
+// Feeds records through a pipe, the way a recording would be replayed, and checks what comes out.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+input_event record(std::chrono::microseconds time, uint16_t type, uint16_t code, int32_t value)
+{
+	input_event result{};
+	result.input_event_sec = time.count() / 1000000;
+	result.input_event_usec = time.count() % 1000000;
+	result.type = type;
+	result.code = code;
+	result.value = value;
+	return result;
+}
+
+std::vector<event> drain(evdev_source& source)
+{
+	std::vector<event> events;
+	while(auto e = source.next_event())
+		events.push_back(*e);
+	return events;
+}
+
+void write_bytes(int fd, const void* bytes, std::size_t size)
+{
+	const auto written = write(fd, bytes, size);
+	assert(written == ssize_t(size));
+	(void)written;
+}
+
+template <std::size_t Size>
+void write_all(int fd, const input_event (&records)[Size])
+{
+	write_bytes(fd, records, sizeof(records));
+}
+
+int main()
+{
+	int fds[2];
+	if(pipe2(fds, O_NONBLOCK) != 0)
+	{
+		std::perror("ERROR");
+		return 1;
+	}
+	evdev_source source(fds[0], 7);
+	assert(source.fd() == fds[0]);
+	assert(source.device_id() == 7);
+	assert(!source.next_event());
+
+	// keys, with the timestamps to the microsecond
+	{
+		const input_event records[] =
+		{
+			record(1000500us, EV_KEY, KEY_A, 1), record(1000500us, EV_SYN, SYN_REPORT, 0),
+			record(1000900us, EV_KEY, KEY_A, 2), record(1000900us, EV_SYN, SYN_REPORT, 0),
+			record(2000000us, EV_KEY, KEY_A, 0), record(2000000us, EV_SYN, SYN_REPORT, 0),
+		};
+		write_all(fds[1], records);
+		const auto events = drain(source);
+		assert(events.size() == 3);
+
+		auto pressed = std::get_if<key_pressed>(&events[0]);
+		assert(pressed);
+		assert(pressed->data.scancode == scancode::a);
+		assert(pressed->data.keycode == to_keycode(scancode::a));
+		assert(pressed->data.repeat == 0);
+		assert(precise_timestamp(events[0]) == 1000500us);
+		assert(timestamp(events[0]) == 1000ms);
+
+		pressed = std::get_if<key_pressed>(&events[1]);
+		assert(pressed && pressed->data.repeat == 1);
+		assert(precise_timestamp(events[1]) == 1000900us);
+
+		auto released = std::get_if<key_released>(&events[2]);
+		assert(released && released->data.scancode == scancode::a);
+		assert(released->data.state == keystate::released);
+		assert(precise_timestamp(events[2]) == 2s);
+	}
+
+	// relative motion is accumulated per frame, and into a position, before the buttons
+	{
+		const input_event records[] =
+		{
+			record(3s, EV_REL, REL_X, 3), record(3s, EV_REL, REL_Y, -2), record(3s, EV_REL, REL_X, 1),
+			record(3s, EV_KEY, BTN_RIGHT, 1), record(3s, EV_SYN, SYN_REPORT, 0),
+			record(4s, EV_REL, REL_Y, 5), record(4s, EV_REL, REL_WHEEL, -1), record(4s, EV_SYN, SYN_REPORT, 0),
+		};
+		write_all(fds[1], records);
+		const auto events = drain(source);
+		assert(events.size() == 4);
+
+		auto motion = std::get_if<mouse_motion>(&events[0]);
+		assert(motion);
+		assert(motion->data.device_id == 7);
+		assert(motion->data.window_id == 0);
+		assert(motion->data.motion == int2(4,-2));
+		assert(motion->data.position == int2(4,-2));
+
+		auto down = std::get_if<mouse_down>(&events[1]);
+		assert(down && down->data.button == mouse_button::right);
+		assert(down->data.position == int2(4,-2));
+
+		motion = std::get_if<mouse_motion>(&events[2]);
+		assert(motion);
+		assert(motion->data.motion == int2(0,5));
+		assert(motion->data.position == int2(4,3));
+		assert(motion->data.button_state == to_mask(mouse_button::right));
+
+		auto wheel = std::get_if<mouse_wheel>(&events[3]);
+		assert(wheel && wheel->data.position == int2(0,-1));
+	}
+
+	// a record split between reads waits for the rest of it
+	{
+		const auto key = record(5s, EV_KEY, KEY_B, 1);
+		const auto report = record(5s, EV_SYN, SYN_REPORT, 0);
+		const auto* bytes = reinterpret_cast<const unsigned char*>(&key);
+		const std::size_t half = sizeof(key) / 2;
+
+		write_bytes(fds[1], bytes, half);
+		assert(!source.next_event());
+		write_bytes(fds[1], bytes + half, sizeof(key) - half);
+		write_bytes(fds[1], &report, sizeof(report));
+		const auto events = drain(source);
+		assert(events.size() == 1);
+
+		auto pressed = std::get_if<key_pressed>(&events[0]);
+		assert(pressed && pressed->data.scancode == scancode::b);
+		assert(precise_timestamp(events[0]) == 5s);
+	}
+
+	// the frame with the overrun is thrown away, the next one is not
+	{
+		const input_event records[] =
+		{
+			record(6s, EV_REL, REL_X, 10), record(6s, EV_SYN, SYN_DROPPED, 0),
+			record(6s, EV_REL, REL_X, 20), record(6s, EV_SYN, SYN_REPORT, 0),
+			record(7s, EV_REL, REL_X, 1), record(7s, EV_SYN, SYN_REPORT, 0),
+		};
+		write_all(fds[1], records);
+		const auto events = drain(source);
+		assert(events.size() == 1);
+
+		auto motion = std::get_if<mouse_motion>(&events[0]);
+		assert(motion && motion->data.motion == int2(1,0));
+		assert(precise_timestamp(events[0]) == 7s);
+	}
+
+	// multitouch slots, normalized to the ranges
+	{
+		source.touch_range({0,100}, {0,200});
+		source.pressure_range({0,10});
+		const input_event records[] =
+		{
+			record(8s, EV_ABS, ABS_MT_SLOT, 0), record(8s, EV_ABS, ABS_MT_TRACKING_ID, 42),
+			record(8s, EV_ABS, ABS_MT_POSITION_X, 50), record(8s, EV_ABS, ABS_MT_POSITION_Y, 50),
+			record(8s, EV_ABS, ABS_MT_PRESSURE, 5), record(8s, EV_SYN, SYN_REPORT, 0),
+			record(9s, EV_ABS, ABS_MT_POSITION_X, 75), record(9s, EV_SYN, SYN_REPORT, 0),
+			record(10s, EV_ABS, ABS_MT_TRACKING_ID, -1), record(10s, EV_SYN, SYN_REPORT, 0),
+		};
+		write_all(fds[1], records);
+		const auto events = drain(source);
+		assert(events.size() == 3);
+
+		auto down = std::get_if<pointer_down>(&events[0]);
+		assert(down);
+		assert(down->data.device_id == 7);
+		assert(down->data.pointer_id == 42);
+		assert(down->data.position == float2(0.5f, 0.25f));
+		assert(down->data.pressure == 0.5f);
+
+		auto motion = std::get_if<pointer_motion>(&events[1]);
+		assert(motion);
+		assert(motion->data.position == float2(0.75f, 0.25f));
+		assert(motion->data.motion == float2(0.25f, 0.f));
+
+		auto up = std::get_if<pointer_up>(&events[2]);
+		assert(up && up->data.pointer_id == 42);
+		assert(precise_timestamp(events[2]) == 10s);
+	}
+
+	close(fds[0]);
+	close(fds[1]);
+	std::puts("evdev records translated");
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::puts("evdev is linux only");
+	return 0;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include <cassert>
+#include <cstdio>
+
+#include "simple/interactive/event.h"
+#include "simple/interactive/event_ref.h"
+
+// translated_index repeats the switch in translate, this keeps the two in agreement,
+// for every SDL event type and every window event.
+
+using namespace simple::interactive;
+
+std::size_t checked = 0;
+
+void check(const SDL_Event& raw)
+{
+	const auto translated = translate(raw);
+	const event_ref ref(raw);
+	assert(ref.index() == (translated ? translated->index() : std::variant_npos));
+	assert(bool(ref) == bool(translated));
+	if(translated)
+	{
+		assert(ref.to_event()->index() == translated->index());
+		assert(ref.timestamp() == timestamp(*translated));
+		assert(ref.precise_timestamp() == precise_timestamp(*translated));
+		assert(ref.window_id() == window_id(*translated));
+	}
+	++checked;
+}
+
+int main()
+{
+	for(Uint32 type = SDL_FIRSTEVENT; type <= SDL_LASTEVENT; ++type)
+	{
+		SDL_Event raw{};
+		raw.type = type;
+		raw.common.timestamp = 1234;
+		if(type == SDL_WINDOWEVENT)
+		{
+			raw.window.windowID = 3;
+			for(int window_event = 0; window_event < 256; ++window_event)
+			{
+				raw.window.event = window_event;
+				check(raw);
+			}
+		}
+		else
+			check(raw);
+	}
+
+	std::printf("%zu events agree\n", checked);
+	return 0;
+}
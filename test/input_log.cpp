@@ -0,0 +1,344 @@
+#include <cassert>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/input_log.h"
+
+// Random frames of every type of event are written and read back field by field,
+// each frame on its own as well as all of them in a row.
+// Then overflow and malformed input.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+std::mt19937 random_engine(11);
+
+int random_int(int min, int max)
+{
+	return std::uniform_int_distribution<int>(min, max)(random_engine);
+}
+
+uint32_t random_bits()
+{
+	return random_engine();
+}
+
+float random_float()
+{
+	return std::uniform_real_distribution<float>(-2.f, 2.f)(random_engine);
+}
+
+// time goes forward mostly, in whole milliseconds like SDL, or not, like evdev, and sometimes back a little
+std::chrono::microseconds now = 1s;
+
+void fill(event_data& data)
+{
+	switch(random_int(0, 3))
+	{
+		case 0: now += std::chrono::milliseconds(random_int(0, 50)); break;
+		case 1: now += std::chrono::microseconds(random_int(0, 50000)); break;
+		case 2: now -= std::chrono::microseconds(random_int(0, 1000)); break;
+		default: now += std::chrono::hours(random_int(0, 100)); break;
+	}
+	data = make_event_data(now);
+}
+
+void fill(window_event_data& data)
+{
+	fill(static_cast<event_data&>(data));
+	data.window_id = random_int(0, 3) == 0 ? random_bits() : random_int(0, 4);
+}
+
+int2 random_position()
+{
+	return int2(random_int(-100000, 100000), random_int(-100000, 100000));
+}
+
+void fill(key_data& data)
+{
+	fill(static_cast<window_event_data&>(data));
+	data.keycode = static_cast<keycode>(random_bits());
+	data.scancode = static_cast<scancode>(random_int(0, SDL_NUM_SCANCODES - 1));
+	data.state = random_int(0, 1) ? keystate::pressed : keystate::released;
+	data.repeat = random_int(0, 255);
+}
+
+void fill(mouse_data& data)
+{
+	fill(static_cast<window_event_data&>(data));
+	data.device_id = random_int(0, 1) ? random_bits() : touch_mouse_id;
+	data.position = random_position();
+}
+
+void fill(mouse_button_data& data)
+{
+	fill(static_cast<mouse_data&>(data));
+	data.button = static_cast<mouse_button>(random_int(0, 255));
+	data.state = random_int(0, 1) ? keystate::pressed : keystate::released;
+#if SDL_VERSION_ATLEAST(2,0,2)
+	data.clicks = random_int(0, 255);
+#endif
+}
+
+void fill(mouse_motion_data& data)
+{
+	fill(static_cast<mouse_data&>(data));
+	data.motion = random_position();
+	data.button_state = static_cast<mouse_button_mask>(random_bits());
+}
+
+void fill(mouse_wheel_data& data)
+{
+	fill(static_cast<mouse_data&>(data));
+#if SDL_VERSION_ATLEAST(2,0,4)
+	data.direction = random_int(0, 1) ? wheel_direction::normal : wheel_direction::flipped;
+#endif
+}
+
+void fill(text_input_data& data)
+{
+	fill(static_cast<window_event_data&>(data));
+	data.text = {};
+	const int length = random_int(0, data.text.size());
+	for(int i = 0; i < length; ++i)
+		data.text[i] = static_cast<char>(random_int(1, 255));
+}
+
+void fill(text_edit_data& data)
+{
+	fill(static_cast<text_input_data&>(data));
+	const int start = random_int(-1000, 1000);
+	data.edit_range = {start, start + random_int(0, 1000)};
+}
+
+void fill(pointer_data& data)
+{
+	fill(static_cast<event_data&>(data));
+	data.device_id = int64_t(random_bits()) << 32 | random_bits();
+	data.pointer_id = random_int(-1, 10);
+	data.position = float2(random_float(), random_float());
+	data.motion = float2(random_float(), random_float());
+	data.pressure = random_float();
+}
+
+void fill(window_vector_data& data)
+{
+	fill(static_cast<window_event_data&>(data));
+	data.value = random_position();
+}
+
+bool same(const event_data& a, const event_data& b)
+{
+	return a.timestamp == b.timestamp && a.precise_timestamp == b.precise_timestamp;
+}
+
+bool same(const window_event_data& a, const window_event_data& b)
+{
+	return same(static_cast<const event_data&>(a), b) && a.window_id == b.window_id;
+}
+
+bool same(const key_data& a, const key_data& b)
+{
+	return same(static_cast<const window_event_data&>(a), b)
+		&& a.keycode == b.keycode && a.scancode == b.scancode
+		&& a.state == b.state && a.repeat == b.repeat;
+}
+
+bool same(const mouse_data& a, const mouse_data& b)
+{
+	return same(static_cast<const window_event_data&>(a), b)
+		&& a.device_id == b.device_id && a.position == b.position;
+}
+
+bool same(const mouse_button_data& a, const mouse_button_data& b)
+{
+	return same(static_cast<const mouse_data&>(a), b)
+		&& a.button == b.button && a.state == b.state
+#if SDL_VERSION_ATLEAST(2,0,2)
+		&& a.clicks == b.clicks
+#endif
+	;
+}
+
+bool same(const mouse_motion_data& a, const mouse_motion_data& b)
+{
+	return same(static_cast<const mouse_data&>(a), b)
+		&& a.motion == b.motion && a.button_state == b.button_state;
+}
+
+bool same(const mouse_wheel_data& a, const mouse_wheel_data& b)
+{
+	return same(static_cast<const mouse_data&>(a), b)
+#if SDL_VERSION_ATLEAST(2,0,4)
+		&& a.direction == b.direction
+#endif
+	;
+}
+
+bool same(const text_input_data& a, const text_input_data& b)
+{
+	return same(static_cast<const window_event_data&>(a), b) && a.text == b.text;
+}
+
+bool same(const text_edit_data& a, const text_edit_data& b)
+{
+	return same(static_cast<const text_input_data&>(a), b)
+		&& a.edit_range.lower() == b.edit_range.lower()
+		&& a.edit_range.upper() == b.edit_range.upper();
+}
+
+bool same(const pointer_data& a, const pointer_data& b)
+{
+	return same(static_cast<const event_data&>(a), b)
+		&& a.device_id == b.device_id && a.pointer_id == b.pointer_id
+		&& a.position == b.position && a.motion == b.motion && a.pressure == b.pressure;
+}
+
+bool same(const window_vector_data& a, const window_vector_data& b)
+{
+	return same(static_cast<const window_event_data&>(a), b) && a.value == b.value;
+}
+
+bool same(const event& a, const event& b)
+{
+	return a.index() == b.index() && std::visit([&b](auto&& a)
+	{
+		return same(a.data, std::get<std::decay_t<decltype(a)>>(b).data);
+	}, a);
+}
+
+template <typename Event>
+event random_event()
+{
+	std::remove_const_t<decltype(Event::data)> data{};
+	fill(data);
+	return Event{{data}};
+}
+
+template <std::size_t... I>
+event random_event(std::index_sequence<I...>)
+{
+	using maker = event (*)();
+	static constexpr maker makers[] = {&random_event<std::variant_alternative_t<I, event>>...};
+	return makers[random_int(0, sizeof...(I) - 1)]();
+}
+
+event random_event()
+{
+	return random_event(std::make_index_sequence<std::variant_size_v<event>>{});
+}
+
+struct frame
+{
+	std::chrono::microseconds time;
+	std::vector<event> events;
+	const uint8_t* begin;
+	const uint8_t* end;
+};
+
+void check_frame(const frame& frame, const uint8_t* buffer_end)
+{
+	input_log_reader reader(frame.begin, buffer_end, frame.time);
+	for(auto& expected : frame.events)
+	{
+		const auto e = reader.next();
+		assert(e && same(*e, expected));
+	}
+	assert(!reader.next());
+	assert(reader.done());
+	assert(reader.position() == frame.end);
+}
+
+int main()
+{
+	std::vector<uint8_t> buffer(1 << 20);
+	std::vector<frame> frames;
+
+	// all in one buffer, one after the other
+	uint8_t* out = buffer.data();
+	for(int i = 0; i < 1000; ++i)
+	{
+		frame frame{now, {}, out, nullptr};
+		const int count = i % 10 == 0 ? 0 : random_int(0, 30);
+		for(int j = 0; j < count; ++j)
+			frame.events.push_back(random_event());
+
+		input_log_writer writer(out, buffer.data() + buffer.size(), frame.time);
+		const bool written = writer.write(frame.events);
+		assert(written);
+		(void)written;
+		out = writer.finish();
+		assert(out);
+		frame.end = out;
+		if(frame.events.empty())
+			assert(frame.end - frame.begin == 1);
+		frames.push_back(frame);
+	}
+
+	// each frame decodes on its own
+	for(std::size_t i = frames.size(); i-- > 0;)
+		check_frame(frames[i], buffer.data() + buffer.size());
+
+	// and one after the other, each one starts where the last one ended
+	const uint8_t* in = buffer.data();
+	for(auto& frame : frames)
+	{
+		input_log_reader reader(in, out, frame.time);
+		while(reader.next());
+		assert(reader.done());
+		in = reader.position();
+	}
+	assert(in == out);
+
+	// any one event fits in the maximum size
+	for(int i = 0; i < 10000; ++i)
+	{
+		const auto e = random_event();
+		uint8_t single[max_encoded_event_size];
+		input_log_writer writer(single, single + sizeof(single), now - std::chrono::hours(random_int(0, 100)));
+		const bool written = writer.write(e);
+		const bool finished = writer.finish();
+		assert(written && finished);
+		(void)written; (void)finished;
+	}
+
+	// too small for the frame
+	{
+		const auto& frame = frames[1].events.empty() ? frames[2] : frames[1];
+		const std::size_t size = frame.end - frame.begin;
+		std::vector<uint8_t> small(size - 1);
+		input_log_writer writer(small.data(), small.data() + small.size(), frame.time);
+		writer.write(frame.events);
+		const auto end = writer.finish();
+		assert(!end);
+		(void)end;
+	}
+
+	// cut short, and an unknown type
+	{
+		const auto& frame = frames[1].events.empty() ? frames[2] : frames[1];
+		input_log_reader reader(frame.begin, frame.end - 1, frame.time);
+		while(reader.next());
+		assert(!reader.done());
+
+		const uint8_t unknown[] = {uint8_t(std::variant_size_v<event> + 1), 0, 0};
+		input_log_reader bad(unknown, unknown + sizeof(unknown), 0us);
+		assert(!bad.next());
+		assert(!bad.done());
+
+		const uint8_t endless[] = {1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+		input_log_reader overlong(endless, endless + sizeof(endless), 0us);
+		assert(!overlong.next());
+		assert(!overlong.done());
+
+		const uint8_t empty[] = {0};
+		input_log_reader idle(empty, empty + sizeof(empty), 0us);
+		assert(!idle.next());
+		assert(idle.done());
+		assert(idle.position() == empty + 1);
+	}
+
+	std::printf("%zu frames, %zu bytes\n", frames.size(), std::size_t(out - buffer.data()));
+	return 0;
+}
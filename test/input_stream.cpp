@@ -0,0 +1,217 @@
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/input_stream.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+// Events sent in packets come out the other end in order, however the bytes are split on the way,
+// and a stream that stops making sense stops.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+std::mt19937 random_engine(3);
+
+// numbered by their timestamps
+event numbered(int number)
+{
+	const auto code = scancode(number % 200 + 4);
+	return key_pressed{{make_event_data(std::chrono::milliseconds(number)), 1, to_keycode(code), code, keystate::pressed, 0}};
+}
+
+std::vector<event> batch(int& number, int count)
+{
+	std::vector<event> events;
+	for(int i = 0; i < count; ++i)
+		events.push_back(numbered(number++));
+	return events;
+}
+
+void check_numbered(const std::vector<event>& events, int count)
+{
+	assert(events.size() == std::size_t(count));
+	for(int i = 0; i < count; ++i)
+		assert(precise_timestamp(events[i]) == std::chrono::milliseconds(i));
+	(void)count;
+}
+
+std::vector<uint8_t> read_all(int fd)
+{
+	std::vector<uint8_t> bytes;
+	uint8_t chunk[4096];
+	ssize_t result;
+	while((result = read(fd, chunk, sizeof(chunk))) > 0)
+		bytes.insert(bytes.end(), chunk, chunk + result);
+	return bytes;
+}
+
+void write_bytes(int fd, const uint8_t* bytes, std::size_t size)
+{
+	const auto written = write(fd, bytes, size);
+	assert(written == ssize_t(size));
+	(void)written;
+}
+
+struct pipe_pair
+{
+	int fds[2];
+	explicit pipe_pair(bool socket = false)
+	{
+		const int result = socket
+			? socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds)
+			: pipe2(fds, O_NONBLOCK);
+		assert(result == 0);
+		(void)result;
+	}
+	~pipe_pair() { close(fds[0]); close(fds[1]); }
+	int in() const { return fds[0]; }
+	int out() const { return fds[1]; }
+};
+
+// what the sender writes for the given number of events, in random batches
+std::vector<uint8_t> encode(int count)
+{
+	pipe_pair wire;
+	input_sender sender(wire.out());
+	assert(sender.fd() == wire.out());
+	assert(sender.send(std::vector<event>{}));
+	assert(sender.pending() == 0);
+	assert(sender.flush() == 0);
+
+	int number = 0;
+	while(number < count)
+	{
+		const int size = std::min(count - number, int(random_engine() % 20 + 1));
+		assert(sender.send(batch(number, size)));
+		if(number < count && random_engine() % 4 == 0)
+			assert(sender.send(numbered(number++)));
+	}
+	assert(sender.pending() > 0);
+	assert(sender.flush() > 0);
+	assert(sender.pending() == 0);
+	return read_all(wire.in());
+}
+
+int main()
+{
+	constexpr int count = 1000;
+	const auto bytes = encode(count);
+
+	// in pieces of random size, some splitting the headers, some the events
+	for(std::size_t max_piece : {std::size_t(1), std::size_t(7), std::size_t(100), bytes.size()})
+	{
+		pipe_pair wire;
+		input_receiver receiver(wire.in());
+		assert(receiver.fd() == wire.in());
+		std::vector<event> received;
+		for(std::size_t sent = 0; sent < bytes.size();)
+		{
+			const std::size_t piece = std::min(bytes.size() - sent, random_engine() % max_piece + 1);
+			write_bytes(wire.out(), bytes.data() + sent, piece);
+			sent += piece;
+			receiver.drain_events(received);
+			assert(!receiver.malformed());
+		}
+		check_numbered(received, count);
+	}
+
+	// more than the socket takes at once, the rest goes out on later flushes
+	{
+		pipe_pair wire(true);
+		const int size = 4096;
+		setsockopt(wire.out(), SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+		input_sender sender(wire.out());
+		input_receiver receiver(wire.in());
+
+		constexpr int many = 20000;
+		int number = 0;
+		while(number < many)
+			sender.send(batch(number, 50));
+
+		std::vector<event> received;
+		int partial = 0;
+		while(sender.pending() > 0)
+		{
+			if(sender.flush() < 0)
+			{
+				assert(errno == EAGAIN || errno == EWOULDBLOCK);
+				++partial;
+			}
+			receiver.drain_events(received);
+		}
+		receiver.drain_events(received);
+		assert(partial > 0);
+		check_numbered(received, many);
+	}
+
+	// a packet bigger than the receiving buffer
+	{
+		pipe_pair wire;
+		input_receiver receiver(wire.in(), 64);
+		write_bytes(wire.out(), bytes.data(), std::min<std::size_t>(bytes.size(), 256));
+		std::vector<event> received;
+		receiver.drain_events(received);
+		assert(receiver.malformed());
+		assert(!receiver.next_event());
+	}
+
+	// garbage in a packet stops everything after it, valid packets included
+	{
+		pipe_pair wire;
+		input_receiver receiver(wire.in());
+
+		uint8_t garbage[input_packet_header_size + 3] = {3};
+		garbage[input_packet_header_size] = 0xee;
+		write_bytes(wire.out(), garbage, sizeof(garbage));
+		write_bytes(wire.out(), bytes.data(), bytes.size());
+
+		assert(!receiver.next_event());
+		assert(receiver.malformed());
+		assert(!receiver.next_event());
+	}
+
+	// a packet that ends before its frame does
+	{
+		pipe_pair wire;
+		input_receiver receiver(wire.in());
+
+		uint8_t cut[input_packet_header_size + 2] = {2};
+		cut[input_packet_header_size] = 1;
+		cut[input_packet_header_size + 1] = 2;
+		write_bytes(wire.out(), cut, sizeof(cut));
+
+		assert(!receiver.next_event());
+		assert(receiver.malformed());
+	}
+
+	// nothing to read is not malformed
+	{
+		pipe_pair wire;
+		input_receiver receiver(wire.in());
+		assert(!receiver.next_event());
+		assert(!receiver.malformed());
+		write_bytes(wire.out(), bytes.data(), 5);
+		assert(!receiver.next_event());
+		assert(!receiver.malformed());
+	}
+
+	std::printf("%d events over %zu bytes\n", count, bytes.size());
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::puts("input streams are linux only");
+	return 0;
+}
+
+#endif
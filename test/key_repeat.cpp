@@ -0,0 +1,170 @@
+#include <cassert>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/key_repeat.h"
+
+// Repeats come at the delay, then every interval, stamped with when they were due, in order with the other events.
+// The wheel underneath is checked against a plain list of deadlines.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+event press(scancode code, std::chrono::microseconds time, uint8_t repeat = 0)
+{
+	return key_pressed{{make_event_data(time), 1, to_keycode(code), code, keystate::pressed, repeat}};
+}
+
+event release(scancode code, std::chrono::microseconds time)
+{
+	return key_released{{make_event_data(time), 1, to_keycode(code), code, keystate::released, 0}};
+}
+
+const key_data* as_repeat(const event& e)
+{
+	auto pressed = std::get_if<key_pressed>(&e);
+	return pressed && pressed->data.repeat ? &pressed->data : nullptr;
+}
+
+void check_wheel()
+{
+	constexpr std::size_t timer_count = 500;
+	timer_wheel wheel(timer_count, 1000);
+	std::vector<uint64_t> deadlines(timer_count, 0);
+	std::mt19937_64 random(7);
+
+	// near, far, and further than the wheel can hold
+	auto pick = [&random](uint64_t now) -> uint64_t
+	{
+		switch(random() % 4)
+		{
+			case 0: return now + random() % 64;
+			case 1: return now + random() % 5000;
+			case 2: return now + random() % 300000;
+			default: return now + timer_wheel::max_delta + random() % 100000;
+		}
+	};
+
+	for(std::size_t id = 0; id < timer_count; ++id)
+	{
+		deadlines[id] = std::max(pick(wheel.now()), wheel.now() + 1);
+		wheel.schedule(id, deadlines[id]);
+	}
+	assert(wheel.pending() == timer_count);
+
+	std::size_t fired = 0;
+	uint64_t end = wheel.now() + 2 * timer_wheel::max_delta;
+	while(wheel.now() < end)
+	{
+		const uint64_t to = std::min(end, wheel.now() + 1 + random() % 20000);
+		wheel.advance(to, [&](std::size_t id, uint64_t expiry)
+		{
+			assert(deadlines[id] == expiry);
+			assert(wheel.now() == expiry);
+			deadlines[id] = 0;
+			++fired;
+
+			// some go again, some get canceled
+			if(id % 3 == 0)
+			{
+				deadlines[id] = pick(wheel.now() + 1);
+				wheel.schedule(id, deadlines[id]);
+			}
+			else if(id % 3 == 1 && wheel.scheduled(id + 1))
+			{
+				wheel.cancel(id + 1);
+				deadlines[id + 1] = 0;
+			}
+		});
+		// nothing is late
+		for(std::size_t id = 0; id < timer_count; ++id)
+		{
+			assert(wheel.scheduled(id) == (deadlines[id] != 0));
+			assert(deadlines[id] == 0 || deadlines[id] > wheel.now());
+		}
+	}
+	assert(fired > timer_count);
+	(void)fired;
+}
+
+int main()
+{
+	check_wheel();
+
+	key_repeater repeater({500ms, 33ms});
+	std::vector<event> out;
+	auto output = [&out](const event& e) { out.push_back(e); };
+
+	// at the delay, then every interval, stamped with when they were due
+	repeater.process(press(scancode::a, 0ms), output);
+	assert(out.size() == 1 && !as_repeat(out[0]));
+	repeater.advance(499999us, output);
+	assert(out.size() == 1);
+	repeater.advance(500ms, output);
+	assert(out.size() == 2);
+	assert(as_repeat(out[1])->scancode == scancode::a);
+	assert(precise_timestamp(out[1]) == 500ms);
+	repeater.advance(1000ms, output);
+	assert(out.size() == 17);
+	for(std::size_t i = 1; i < out.size(); ++i)
+		assert(precise_timestamp(out[i]) == 500ms + (i - 1) * 33ms);
+
+	// due ones come out before the event that passes their time, OS repeats are dropped
+	out.clear();
+	const event events[] = {press(scancode::a, 1020ms, 1), release(scancode::a, 1030ms)};
+	repeater.process(events, output);
+	assert(out.size() == 2);
+	assert(as_repeat(out[0]) && precise_timestamp(out[0]) == 1028ms);
+	assert(std::holds_alternative<key_released>(out[1]));
+	repeater.advance(5s, output);
+	assert(out.size() == 2);
+
+	// microsecond presses, the repeats keep the microseconds,
+	// but come with the millisecond tick after they are due, never before
+	out.clear();
+	repeater.process(press(scancode::b, 5000250us), output);
+	repeater.advance(5533250us, output);
+	assert(out.size() == 2);
+	repeater.advance(5534ms, output);
+	assert(out.size() == 3);
+	assert(precise_timestamp(out[1]) == 5500250us);
+	assert(precise_timestamp(out[2]) == 5533250us);
+	repeater.release_all();
+	repeater.advance(10s, output);
+	assert(out.size() == 3);
+
+	// per key rates, zero interval doesn't repeat
+	repeater.rate(scancode::c, {100ms, 10ms});
+	repeater.rate(scancode::d, {100ms, 0ms});
+	assert(repeater.rate(scancode::c).interval == 10ms);
+	assert(repeater.rate(scancode::a).interval == 33ms);
+	out.clear();
+	const event held[] = {press(scancode::c, 10s), press(scancode::d, 10s), press(scancode::e, 10s)};
+	repeater.process(held, output);
+	repeater.advance(10s + 130ms, output);
+	assert(out.size() == 3 + 4);
+	for(std::size_t i = 3; i < out.size(); ++i)
+		assert(as_repeat(out[i])->scancode == scancode::c);
+
+	// the default changes the keys that don't have their own rate
+	repeater.default_rate({1s, 1s});
+	assert(repeater.rate(scancode::a).delay == 1s);
+	assert(repeater.rate(scancode::c).delay == 100ms);
+	repeater.reset_rate(scancode::c);
+	assert(repeater.rate(scancode::c).delay == 1s);
+
+	// out of range scancodes are ignored
+	const auto out_of_range = scancode(SDL_NUM_SCANCODES + 10);
+	repeater.rate(out_of_range, {1ms, 1ms});
+	repeater.reset_rate(out_of_range);
+	assert(repeater.rate(out_of_range).delay == 1s);
+	out.clear();
+	repeater.release_all();
+	repeater.process(press(out_of_range, 20s), output);
+	repeater.advance(30s, output);
+	assert(out.size() == 1);
+
+	std::puts("repeats on time");
+	return 0;
+}
@@ -0,0 +1,130 @@
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/late_latch.h"
+
+// The motion at the front of the queue updates the targets, and is handed on once per mouse, summed up.
+// Nothing behind another event is taken, and nothing gets ahead of what was already taken out of the queue.
+
+using namespace simple::interactive;
+
+void push_motion(uint32_t window_id, uint32_t device_id, int2 position, int2 motion)
+{
+	SDL_Event raw{};
+	raw.type = SDL_MOUSEMOTION;
+	raw.motion.windowID = window_id;
+	raw.motion.which = device_id;
+	raw.motion.x = position.x();
+	raw.motion.y = position.y();
+	raw.motion.xrel = motion.x();
+	raw.motion.yrel = motion.y();
+	SDL_PushEvent(&raw);
+}
+
+void push(Uint32 type)
+{
+	SDL_Event raw{};
+	raw.type = type;
+	SDL_PushEvent(&raw);
+}
+
+std::vector<event> drain()
+{
+	std::vector<event> events;
+	drain_events(events, no_pump);
+	return events;
+}
+
+int main()
+{
+	initializer init;
+	late_latch latch;
+
+	int2 first_window{}, any_window{};
+	float2 accumulated{};
+	motion_curve doubled;
+	doubled.sensitivity = float2(2.f, 2.f);
+	latch.cursor(first_window, 1);
+	latch.cursor(any_window);
+	latch.motion(accumulated, doubled);
+
+	// nothing to take
+	assert(latch.latch(no_pump) == 0);
+	std::vector<event> latched;
+	assert(latch.take_latched(latched) == 0);
+
+	push_motion(1, 5, int2(10,10), int2(1,1));
+	push_motion(2, 6, int2(20,20), int2(2,0));
+	push_motion(1, 5, int2(12,10), int2(2,0));
+	push(SDL_KEYDOWN);
+	push_motion(1, 5, int2(50,50), int2(5,5));
+	pump();
+
+	assert(latch.latch(no_pump) == 3);
+	assert(first_window == int2(12,10));
+	assert(any_window == int2(12,10));
+	assert(accumulated == float2(10.f, 2.f));
+
+	// stopped at the key press
+	assert(latch.latch(no_pump) == 0);
+
+	// one per mouse, the latest, with all the motion
+	assert(latch.take_latched(latched) == 2);
+	auto mouse = std::get<mouse_motion>(latched[0]).data;
+	assert(mouse.device_id == 5);
+	assert(mouse.position == int2(12,10));
+	assert(mouse.motion == int2(3,1));
+	mouse = std::get<mouse_motion>(latched[1]).data;
+	assert(mouse.device_id == 6);
+	assert(mouse.motion == int2(2,0));
+	assert(latch.take_latched(latched) == 0);
+
+	// the rest is where it was
+	auto rest = drain();
+	assert(rest.size() == 2);
+	assert(std::holds_alternative<key_pressed>(rest[0]));
+	assert(std::get<mouse_motion>(rest[1]).data.position == int2(50,50));
+	assert(first_window == int2(12,10));
+
+	// more than a batch
+	for(int i = 0; i < 200; ++i)
+		push_motion(2, 6, int2(i,i), int2(1,0));
+	push(SDL_KEYUP);
+	assert(latch.latch() == 200);
+	assert(first_window == int2(12,10));
+	assert(any_window == int2(199,199));
+	assert(accumulated == float2(410.f, 2.f));
+	latched.clear();
+	assert(latch.take_latched(latched) == 1);
+	assert(std::get<mouse_motion>(latched[0]).data.motion == int2(200,0));
+	rest = drain();
+	assert(rest.size() == 1 && std::holds_alternative<key_released>(rest[0]));
+
+	// events already out of the queue go first, so nothing is taken past them
+	priority_lanes(true);
+	push_motion(1, 5, int2(1,1), int2(1,1));
+	push(SDL_QUIT);
+	push(SDL_QUIT);
+	pump();
+	assert(std::holds_alternative<quit_request>(*next_event(no_pump)));
+	assert(buffered_events() == 1);
+	assert(latch.latch(no_pump) == 0);
+	rest = drain();
+	assert(rest.size() == 2);
+	assert(std::holds_alternative<quit_request>(rest[0]));
+	assert(std::holds_alternative<mouse_motion>(rest[1]));
+	priority_lanes(false);
+
+	// no targets, still latched for later
+	latch.clear();
+	push_motion(1, 5, int2(7,7), int2(1,1));
+	assert(latch.latch() == 1);
+	assert(first_window == int2(12,10));
+	latched.clear();
+	assert(latch.take_latched(latched) == 1);
+
+	std::puts("motion latched");
+	return 0;
+}
@@ -0,0 +1,74 @@
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+#include "simple/interactive/motion.h"
+
+// Motion is kept per device, and scaled down motion adds up instead of rounding away.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+mouse_motion motion(uint32_t device_id, int2 relative)
+{
+	return mouse_motion{make_event_data(1ms), 1, device_id, int2::zero(), relative, mouse_button_mask::none};
+}
+
+bool near(float2 a, float2 b)
+{
+	return std::abs(a.x() - b.x()) < 0.0001f && std::abs(a.y() - b.y()) < 0.0001f;
+}
+
+int main()
+{
+	motion_accumulator accumulator;
+	assert(accumulator.motion(1) == float2{});
+	assert(accumulator.take(1) == float2{});
+	assert(accumulator.take_whole(1) == int2{});
+
+	// a quarter of a pixel at a time
+	motion_curve slow;
+	slow.sensitivity = float2(0.25f, 0.25f);
+	accumulator.default_curve(slow);
+	assert(accumulator.default_curve().sensitivity == slow.sensitivity);
+
+	for(int i = 0; i < 5; ++i)
+		accumulator.feed(event{motion(1, int2(1,-1))});
+	assert(near(accumulator.motion(1), float2(1.25f, -1.25f)));
+	assert(accumulator.take_whole(1) == int2(1,-1));
+	assert(near(accumulator.motion(1), float2(0.25f, -0.25f)));
+	for(int i = 0; i < 3; ++i)
+		accumulator.feed(event{motion(1, int2(1,-1))});
+	assert(accumulator.take_whole(1) == int2(1,-1));
+	assert(near(accumulator.take(1), float2{}));
+
+	// other devices are separate, and can have their own curve
+	motion_curve fast;
+	fast.sensitivity = float2(2.f, 3.f);
+	accumulator.curve(2, fast);
+	const event events[] = {motion(1, int2(4,0)), motion(2, int2(1,1)), motion(2, int2(1,0))};
+	accumulator.feed(events);
+	assert(near(accumulator.motion(1), float2(1.f, 0.f)));
+	assert(near(accumulator.motion(2), float2(4.f, 3.f)));
+	assert(near(accumulator.take(2), float2(4.f, 3.f)));
+	assert(accumulator.motion(2) == float2{});
+	assert(near(accumulator.motion(1), float2(1.f, 0.f)));
+
+	// acceleration, gain is 1 + acceleration * speed^exponent, up to max_gain
+	motion_curve accelerated;
+	accelerated.acceleration = 0.5f;
+	accelerated.exponent = 1.f;
+	accelerated.max_gain = 2.f;
+	assert(near(apply(accelerated, int2(0,0)), float2{}));
+	assert(near(apply(accelerated, int2(1,0)), float2(1.5f, 0.f)));
+	assert(near(apply(accelerated, int2(3,4)), float2(6.f, 8.f)));
+	accelerated.max_gain = 10.f;
+	assert(near(apply(accelerated, int2(3,4)), float2(10.5f, 14.f)));
+
+	accumulator.curve(3, accelerated);
+	accumulator.feed(motion(3, int2(0,-2)).data);
+	assert(near(accumulator.take(3), float2(0.f, -4.f)));
+
+	std::puts("motion accumulated");
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include <cassert>
+#include <cstdio>
+
+#include "simple/interactive/mouse_state.h"
+
+// Each mouse gets its own position, buttons and wheel, the touch mouse is kept out of the table.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+int main()
+{
+	mouse_state_table mice;
+	assert(!mice.find(1));
+	assert(mice.device_ids().empty());
+
+	const event events[] =
+	{
+		mouse_motion{make_event_data(1ms), 5, 1, int2(10,10), int2(1,1), mouse_button_mask::none},
+		mouse_down{make_event_data(2ms), 5, 1, int2(11,10), mouse_button::left, keystate::pressed, 1},
+		mouse_motion{make_event_data(3ms), 6, 2, int2(50,60), int2(0,1), to_mask(mouse_button::right)},
+		mouse_down{make_event_data(4ms), 5, 1, int2(11,10), mouse_button::middle, keystate::pressed, 1},
+		mouse_up{make_event_data(5ms), 5, 1, int2(12,10), mouse_button::left, keystate::released, 1},
+		mouse_wheel{make_event_data(6ms), 5, 1, int2(0,1), wheel_direction::normal},
+		mouse_wheel{make_event_data(7ms), 5, 1, int2(0,2), wheel_direction::normal},
+		mouse_wheel{make_event_data(8ms), 5, 1, int2(1,0), wheel_direction::flipped},
+		mouse_motion{make_event_data(9ms), 7, touch_mouse_id, int2(3,3), int2(3,3), to_mask(mouse_button::left)},
+		key_pressed{{make_event_data(10ms), 5, keycode::a, scancode::a, keystate::pressed, 0}},
+	};
+	mice.update(events);
+
+	assert(mice.device_ids().size() == 2);
+	assert(mice.states().size() == 2);
+
+	const auto first = mice.find(1);
+	assert(first);
+	assert(first->window_id == 5);
+	assert(first->position == int2(12,10));
+	assert(first->buttons == to_mask(mouse_button::middle));
+	assert(first->wheel == int2(-1,3));
+	assert(first->timestamp == 8ms);
+
+	const auto second = mice.find(2);
+	assert(second);
+	assert(second->window_id == 6);
+	assert(second->position == int2(50,60));
+	assert(second->buttons == to_mask(mouse_button::right));
+	assert(second->wheel == int2::zero());
+	assert(second->timestamp == 3ms);
+
+	// parallel arrays
+	for(std::size_t i = 0; i < mice.device_ids().size(); ++i)
+		assert(mice.find(mice.device_ids()[i]) == &mice.states()[i]);
+
+	assert(mice.find(touch_mouse_id) == &mice.touch());
+	assert(mice.touch().position == int2(3,3));
+	assert(mice.touch().buttons == to_mask(mouse_button::left));
+
+	mice.reset_wheel();
+	assert(mice.find(1)->wheel == int2::zero());
+	assert(mice.find(1)->position == int2(12,10));
+
+	std::puts("mouse states tracked");
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <cassert>
+#include <cstdio>
+#include <array>
+#include <memory>
+#include <string>
+
+#include "simple/interactive/names.h"
+#include "simple/interactive/perfect_hash.hpp"
+
+// Every value that has a name is found by it, in any case, and the lookup rejects everything else.
+// The names come from the enumerators, so going over all the values goes over all the enumerators.
+
+using namespace simple::interactive;
+
+std::string upper(std::string_view name)
+{
+	std::string result(name);
+	for(auto& c : result)
+		if(c >= 'a' && c <= 'z')
+			c = c - 'a' + 'A';
+	return result;
+}
+
+template <typename Value, typename Lookup>
+std::size_t check_round_trip(Value value, Lookup lookup)
+{
+	const auto name = to_string(value);
+	if(name.empty())
+		return 0;
+
+	assert(lookup(name) == value);
+	assert(lookup(upper(name)) == value);
+	assert(!lookup(std::string(name) + " "));
+	return 1;
+}
+
+int main()
+{
+	std::size_t named = 0;
+
+	for(int code = 0; code < SDL_NUM_SCANCODES; ++code)
+		named += check_round_trip(scancode(code), [](std::string_view name) { return to_scancode(name); });
+	const std::size_t scancode_names = named;
+	assert(scancode_names > 200);
+
+	for(SDL_Keycode code = 0; code < 128; ++code)
+		named += check_round_trip(keycode(code), [](std::string_view name) { return to_keycode(name); });
+	for(SDL_Keycode code = 0; code < SDL_NUM_SCANCODES; ++code)
+		named += check_round_trip(keycode(code | SDLK_SCANCODE_MASK), [](std::string_view name) { return to_keycode(name); });
+	assert(named - scancode_names > 200);
+
+	for(int button = 0; button < 256; ++button)
+		named += check_round_trip(mouse_button(button), [](std::string_view name) { return to_mouse_button(name); });
+
+	for(auto button : {mouse_button::left, mouse_button::right, mouse_button::middle, mouse_button::x1, mouse_button::x2})
+		assert(!to_string(button).empty());
+
+	// unmasked keycodes above ascii have no name
+	assert(to_string(keycode(SDL_NUM_SCANCODES)).empty());
+	assert(to_string(keycode(1000)).empty());
+
+	// digits lose the underscore
+	assert(to_string(keycode::_0) == "0");
+	assert(to_keycode("0") == keycode::_0);
+	assert(!to_keycode("_0"));
+	assert(to_scancode("KP_Enter") == scancode::kp_enter);
+	assert(to_mouse_button("X2") == mouse_button::x2);
+
+	for(auto miss : {"", " ", "not a key", "f0", "kp_", "a ", "aa", "leftt", "\xff"})
+	{
+		assert(!to_keycode(miss));
+		assert(!to_scancode(miss));
+		assert(!to_mouse_button(miss));
+	}
+
+	// the map itself, over a lot more names than the tables have
+	{
+		constexpr std::size_t count = 2000;
+		static std::array<std::string, count> names;
+		static name_entry<int> entries[count];
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			names[i] = "name_" + std::to_string(i * 7919);
+			entries[i] = {names[i], int(i)};
+		}
+		const auto map = std::make_unique<perfect_hash_map<int, count>>(entries);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			assert(map->find(names[i]) == int(i));
+			assert(map->find(upper(names[i])) == int(i));
+			assert(!map->find(names[i] + "_"));
+		}
+		assert(!map->find("name_1"));
+		assert(!map->find("name_"));
+	}
+
+	std::printf("%zu names found\n", named);
+	return 0;
+}
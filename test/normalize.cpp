@@ -0,0 +1,131 @@
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/normalize.h"
+
+// The batch functions agree with the one at a time getters, element for element,
+// over more windows than are remembered at once, with a window that doesn't exist thrown in.
+
+using namespace simple::interactive;
+
+std::mt19937 random_engine(7);
+
+bool close(float a, float b)
+{
+	return std::abs(a - b) <= 1e-5f * std::max(1.f, std::abs(b));
+}
+
+template <typename Single>
+void check(const float2* out, const bool* valid, std::size_t count, Single single)
+{
+	for(std::size_t i = 0; i < count; ++i)
+	{
+		const std::optional<float2> expected = single(i);
+		assert(valid[i] == bool(expected));
+		if(expected)
+			assert(close(out[i].x(), expected->x()) && close(out[i].y(), expected->y()));
+		else
+			assert(out[i] == float2::zero());
+	}
+}
+
+int2 random_vector(int range)
+{
+	return int2(int(random_engine() % (2 * range)) - range, int(random_engine() % (2 * range)) - range);
+}
+
+int main()
+{
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", false);
+
+	initializer init;
+	simple::sdlcore::initializer video(simple::sdlcore::system_flag::video);
+
+	std::vector<SDL_Window*> windows;
+	std::vector<uint32_t> window_ids{0};
+	for(int i = 0; i < 10; ++i)
+	{
+		SDL_Window* window = SDL_CreateWindow("normalize", 10 * i, 20 * i, 64 + 16 * i, 48 + 8 * i, SDL_WINDOW_HIDDEN);
+		assert(window);
+		windows.push_back(window);
+		window_ids.push_back(SDL_GetWindowID(window));
+	}
+	window_ids.push_back(window_ids.back() + 100);
+
+	// not a multiple of the chunk size
+	constexpr std::size_t count = 500;
+	std::vector<mouse_motion_data> motions(count);
+	std::vector<mouse_button_data> buttons(count);
+	std::vector<uint32_t> ids(count);
+	std::vector<int> x(count), y(count);
+	for(std::size_t i = 0; i < count; ++i)
+	{
+		// runs of the same window, with strays in between
+		ids[i] = random_engine() % 4 == 0 || i == 0
+			? window_ids[random_engine() % window_ids.size()]
+			: ids[i - 1];
+		motions[i].window_id = ids[i];
+		motions[i].position = random_vector(500);
+		motions[i].motion = random_vector(50);
+		buttons[i].window_id = ids[i];
+		buttons[i].position = random_vector(500);
+		x[i] = motions[i].position.x();
+		y[i] = motions[i].position.y();
+	}
+
+	std::vector<float2> out(count);
+	bool valid[count];
+
+	window_normalized_positions(motions.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return window_normalized_position(motions[i]); });
+	screen_normalized_positions(motions.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return screen_normalized_position(motions[i]); });
+
+	window_normalized_positions(buttons.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return window_normalized_position(buttons[i]); });
+	screen_normalized_positions(buttons.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return screen_normalized_position(buttons[i]); });
+
+	window_normalized_motions(motions.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return window_normalized_motion(motions[i]); });
+	screen_normalized_motions(motions.data(), count, out.data(), valid);
+	check(out.data(), valid, count, [&](std::size_t i) { return screen_normalized_motion(motions[i]); });
+
+	// the plain arrays give the same
+	std::vector<float> out_x(count), out_y(count);
+	bool plain_valid[count];
+	window_normalize(ids.data(), x.data(), y.data(), count, out_x.data(), out_y.data(), plain_valid);
+	window_normalized_positions(motions.data(), count, out.data(), valid);
+	for(std::size_t i = 0; i < count; ++i)
+		assert(plain_valid[i] == valid[i] && float2(out_x[i], out_y[i]) == out[i]);
+
+	screen_normalize(ids.data(), x.data(), y.data(), count, out_x.data(), out_y.data(), plain_valid);
+	screen_normalized_positions(motions.data(), count, out.data(), valid);
+	for(std::size_t i = 0; i < count; ++i)
+		assert(plain_valid[i] == valid[i] && float2(out_x[i], out_y[i]) == out[i]);
+
+	// the window that isn't there
+	std::size_t invalid = 0;
+	for(std::size_t i = 0; i < count; ++i)
+		invalid += !valid[i];
+	assert(invalid > 0);
+
+	// nothing is written past the end
+	out.assign(count, float2::one());
+	window_normalized_positions(motions.data(), 0, out.data(), valid);
+	window_normalized_positions(motions.data(), 1, out.data(), valid);
+	for(std::size_t i = 1; i < count; ++i)
+		assert(out[i] == float2::one());
+
+	for(auto window : windows)
+		SDL_DestroyWindow(window);
+
+	std::printf("%zu normalized, %zu without a window\n", count - invalid, invalid);
+	return 0;
+}
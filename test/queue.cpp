@@ -0,0 +1,188 @@
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/event.h"
+#include "simple/interactive/queue.h"
+
+// The no_pump functions take the same events, in the same order, as the pumping ones.
+// A drain starts over with pump(), begin_drain() or drain_events, and the priority lanes and spilling run at its start.
+
+using namespace simple::interactive;
+
+// SDL stamps the time when pushing, so events are tagged with the window id,
+// which is in the same place for all of them, except quit, which has none
+void push(Uint32 type, Uint32 tag, Uint8 window_event = 0)
+{
+	SDL_Event raw{};
+	raw.type = type;
+	if(type != SDL_QUIT)
+		raw.window.windowID = tag;
+	if(type == SDL_WINDOWEVENT)
+		raw.window.event = window_event;
+	else if(type == SDL_KEYDOWN || type == SDL_KEYUP)
+		raw.key.keysym.scancode = SDL_SCANCODE_A;
+	SDL_PushEvent(&raw);
+}
+
+Uint32 tag(const event& e)
+{
+	return window_id(e);
+}
+
+template <typename... Pump>
+std::vector<Uint32> take_tags(Pump... pump)
+{
+	std::vector<Uint32> tags;
+	while(auto e = next_event(pump...))
+		tags.push_back(tag(*e));
+	return tags;
+}
+
+using tags = std::vector<Uint32>;
+
+int main()
+{
+	initializer init;
+
+	// the same with or without
+	{
+		for(Uint32 i = 1; i <= 5; ++i)
+			push(i % 2 ? SDL_KEYDOWN : SDL_MOUSEMOTION, i);
+		pump();
+		assert(take_tags(no_pump) == (tags{1,2,3,4,5}));
+		assert(!next_event(no_pump));
+
+		for(Uint32 i = 1; i <= 5; ++i)
+			push(SDL_KEYUP, i);
+		assert(take_tags() == (tags{1,2,3,4,5}));
+
+		std::vector<event> events;
+		push(SDL_KEYDOWN, 1);
+		push(SDL_KEYUP, 2);
+		pump();
+		assert(drain_events(events, no_pump) == 2);
+		push(SDL_KEYDOWN, 3);
+		assert(drain_events(events) == 1);
+		assert(events.size() == 3);
+		assert(tag(events[2]) == 3);
+
+		SDL_Event raw;
+		push(SDL_KEYDOWN, 4);
+		assert(poll_event(raw, no_pump));
+		assert(raw.window.windowID == 4);
+		assert(!poll_event(raw, no_pump));
+		assert(!poll_event(raw));
+	}
+
+	// waiting doesn't take
+	{
+		assert(!wait_for_events(0));
+		push(SDL_KEYDOWN, 1);
+		assert(wait_for_events(0));
+		assert(wait_for_events(0));
+		assert(take_tags(no_pump) == (tags{1}));
+	}
+
+	// a range of types, the rest stays in order
+	{
+		push(SDL_KEYDOWN, 1);
+		push(SDL_MOUSEMOTION, 2);
+		push(SDL_KEYUP, 3);
+		push(SDL_MOUSEBUTTONDOWN, 4);
+		SDL_Event keys[4];
+		assert(take_events(keys, 4, SDL_KEYDOWN, SDL_KEYUP) == 2);
+		assert(keys[0].key.windowID == 1 && keys[1].key.windowID == 3);
+		assert(take_events(keys, 4, SDL_KEYDOWN, SDL_KEYUP) == 0);
+		assert(take_tags(no_pump) == (tags{2,4}));
+	}
+
+	// priority lanes, checked when a drain starts
+	{
+		priority_lanes(true);
+		push(SDL_KEYDOWN, 1);
+		push(SDL_WINDOWEVENT, 2, SDL_WINDOWEVENT_MOVED);
+		push(SDL_WINDOWEVENT, 3, SDL_WINDOWEVENT_FOCUS_LOST);
+		push(SDL_KEYUP, 4);
+		push(SDL_QUIT, 5);
+		pump();
+
+		// close, focus and quit go first, in order, moved keeps its place
+		auto e = next_event(no_pump);
+		assert(e && tag(*e) == 3);
+		assert(buffered_events() == 1);
+
+		// the drain is under way, so a quit pushed now waits its turn
+		push(SDL_QUIT, 6);
+		assert(take_tags(no_pump) == (tags{0,1,2,4,0}));
+
+		// the queue ran empty, which ended the drain
+		push(SDL_KEYDOWN, 7);
+		push(SDL_QUIT, 8);
+		assert(take_tags(no_pump) == (tags{0,7}));
+
+		// stopping early, then starting over
+		push(SDL_KEYDOWN, 9);
+		push(SDL_KEYDOWN, 10);
+		assert(tag(*next_event(no_pump)) == 9);
+		push(SDL_WINDOWEVENT, 11, SDL_WINDOWEVENT_CLOSE);
+		begin_drain();
+		assert(take_tags(no_pump) == (tags{11,10}));
+
+		push(SDL_KEYDOWN, 12);
+		assert(tag(*next_event()) == 12);
+		push(SDL_KEYDOWN, 13);
+		push(SDL_WINDOWEVENT, 14, SDL_WINDOWEVENT_FOCUS_GAINED);
+		std::vector<event> events;
+		drain_events(events);
+		assert(events.size() == 2);
+		assert(tag(events[0]) == 14);
+
+		priority_lanes(false);
+		push(SDL_KEYDOWN, 15);
+		push(SDL_QUIT, 16);
+		pump();
+		assert(take_tags(no_pump) == (tags{15,0}));
+	}
+
+	// spilling, at the start of a drain
+	{
+		reset_queue_stats();
+		track_queue_pressure(true);
+		spill_mode(4);
+		for(Uint32 i = 1; i <= 10; ++i)
+			push(SDL_KEYDOWN, i);
+		pump();
+		auto e = next_event(no_pump);
+		assert(e && tag(*e) == 1);
+		auto stats = queue_pressure();
+		assert(stats.spills == 1);
+		assert(stats.peak_depth == 10);
+		// it started at the high water mark
+		assert(stats.spilled_events == 4);
+		assert(buffered_events() == 3);
+
+		// what stayed behind comes after
+		push(SDL_KEYDOWN, 11);
+		assert(take_tags(no_pump) == (tags{2,3,4,5,6,7,8,9,10,11}));
+		assert(queue_pressure().dropped == 0);
+
+		// grown to what the last spill wanted
+		grow_spill();
+		for(Uint32 i = 1; i <= 10; ++i)
+			push(SDL_KEYDOWN, i);
+		pump();
+		assert(tag(*next_event(no_pump)) == 1);
+		stats = queue_pressure();
+		assert(stats.spills == 2);
+		assert(stats.spilled_events == 4 + 10);
+		assert(take_tags(no_pump) == (tags{2,3,4,5,6,7,8,9,10}));
+
+		spill_mode(0);
+		track_queue_pressure(false);
+	}
+
+	std::puts("queue drained in order");
+	return 0;
+}
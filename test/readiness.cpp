@@ -0,0 +1,85 @@
+#include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/readiness.h"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <unistd.h>
+
+// The descriptor is readable from the first notification until clear, and counts only once in between.
+
+using namespace simple::interactive;
+
+bool readable(int fd, int timeout = 0)
+{
+	pollfd descriptor{fd, POLLIN, 0};
+	return poll(&descriptor, 1, timeout) == 1 && (descriptor.revents & POLLIN);
+}
+
+int main()
+{
+	input_readiness readiness;
+	assert(readiness.fd() >= 0);
+	assert(!readable(readiness.fd()));
+
+	readiness.notify();
+	assert(readable(readiness.fd()));
+	readiness.notify();
+	readiness.notify();
+	assert(readable(readiness.fd()));
+
+	// only the first one got written
+	uint64_t count = 0;
+	const auto result = read(readiness.fd(), &count, sizeof(count));
+	assert(result == sizeof(count));
+	assert(count == 1);
+	(void)result;
+	assert(!readable(readiness.fd()));
+
+	// and until cleared, notifications don't signal
+	readiness.notify();
+	assert(!readable(readiness.fd()));
+	readiness.clear();
+	assert(!readable(readiness.fd()));
+
+	// from another thread
+	std::thread notifier([&readiness]() { readiness.notify(); });
+	assert(readable(readiness.fd(), 5000));
+	notifier.join();
+	readiness.clear();
+	assert(!readable(readiness.fd()));
+
+	// pushed events
+	{
+		initializer init;
+		readiness.watch_sdl(true);
+		SDL_Event raw{};
+		raw.type = SDL_USEREVENT;
+		SDL_PushEvent(&raw);
+		assert(readable(readiness.fd()));
+		readiness.clear();
+		SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+		readiness.watch_sdl(false);
+		SDL_PushEvent(&raw);
+		assert(!readable(readiness.fd()));
+		SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+	}
+
+	std::puts("readiness signalled");
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::puts("input_readiness is linux only");
+	return 0;
+}
+
+#endif
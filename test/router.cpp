@@ -0,0 +1,149 @@
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "simple/interactive/router.h"
+
+// Each event goes to the handler of its window, however many windows there are and in whatever order they were routed,
+// everything else goes to the fallback, and unrouting a window sends its events there too.
+
+using namespace simple::interactive;
+
+// the timestamp says where the event should end up
+event key(uint32_t window_id, int tag)
+{
+	return key_pressed{{make_event_data(std::chrono::milliseconds(tag)), window_id, keycode::a, scancode::a, keystate::pressed, 0}};
+}
+
+event shown(uint32_t window_id, int tag)
+{
+	return window_shown{{make_event_data(std::chrono::milliseconds(tag)), window_id}};
+}
+
+struct handler_log
+{
+	std::vector<std::pair<uint32_t, int>> seen;
+	void operator()(const event& e)
+	{
+		seen.push_back({window_id(e), int(timestamp(e).count())});
+	}
+};
+
+// the plain function version, with the window in the context
+std::vector<std::pair<uintptr_t, uint32_t>> plain_log;
+void plain_handler(void* context, const event& e)
+{
+	plain_log.push_back({reinterpret_cast<uintptr_t>(context), window_id(e)});
+}
+
+int main()
+{
+	window_router router;
+	handler_log fallback;
+	router.fallback(fallback);
+
+	// nothing routed
+	assert(!router.routed(0) && !router.routed(1));
+	assert(!router.dispatch(key(1, 0)));
+	assert(fallback.seen.size() == 1);
+	fallback.seen.clear();
+
+	// not a window
+	router.route(0, plain_handler);
+	assert(!router.routed(0));
+
+	// many windows, routed out of order, so the table grows in jumps and in steps
+	constexpr uint32_t windows = 1000;
+	std::vector<uint32_t> order;
+	for(uint32_t id = 1; id <= windows; ++id)
+		order.push_back(id);
+	std::mt19937 random(11);
+	std::shuffle(order.begin(), order.end(), random);
+
+	std::vector<handler_log> logs(windows + 1);
+	for(auto id : order)
+	{
+		router.route(id, logs[id]);
+		assert(router.routed(id));
+	}
+	for(uint32_t id = 1; id <= windows; ++id)
+		assert(router.routed(id));
+	assert(!router.routed(windows + 1));
+	assert(!router.routed(uint32_t(-1)));
+
+	std::vector<event> events;
+	std::vector<std::size_t> expected(windows + 1, 0);
+	std::size_t to_fallback = 0;
+	for(int tag = 0; tag < 10000; ++tag)
+	{
+		// a few beyond the routed ones, and some with no window
+		const uint32_t id = random() % (windows + 10);
+		events.push_back(tag % 2 ? key(id, tag) : shown(id, tag));
+		if(id >= 1 && id <= windows)
+			++expected[id];
+		else
+			++to_fallback;
+	}
+	events.push_back(quit_request{make_event_data(std::chrono::milliseconds(10000))});
+	events.push_back(pointer_down{{make_event_data(std::chrono::milliseconds(10001)), 1, 0, float2::zero(), float2::zero(), 1.f}});
+	to_fallback += 2;
+
+	assert(router.dispatch(events) == events.size() - to_fallback);
+	assert(fallback.seen.size() == to_fallback);
+	for(auto [id, tag] : fallback.seen)
+		assert(id == 0 || id > windows);
+	for(uint32_t id = 1; id <= windows; ++id)
+	{
+		assert(logs[id].seen.size() == expected[id]);
+		// in order
+		int last = -1;
+		for(auto [seen_id, tag] : logs[id].seen)
+		{
+			assert(seen_id == id);
+			assert(tag > last);
+			last = tag;
+		}
+	}
+
+	// unrouted windows go to the fallback, the rest don't notice
+	router.unroute(windows);
+	router.unroute(500);
+	router.unroute(windows + 50);
+	assert(!router.routed(windows) && !router.routed(500));
+	assert(router.routed(windows - 1) && router.routed(501));
+	fallback.seen.clear();
+	logs[499].seen.clear();
+	assert(!router.dispatch(key(windows, 0)));
+	assert(!router.dispatch(key(500, 1)));
+	assert(router.dispatch(key(499, 2)));
+	assert(fallback.seen.size() == 2);
+	assert(logs[499].seen.size() == 1);
+
+	// routed again, to a plain function this time
+	router.route(500, plain_handler, reinterpret_cast<void*>(uintptr_t(500)));
+	router.route(windows + 20, plain_handler, reinterpret_cast<void*>(uintptr_t(windows + 20)));
+	assert(router.dispatch(key(500, 0)));
+	assert(router.dispatch(shown(windows + 20, 1)));
+	assert(plain_log.size() == 2);
+	assert(plain_log[0] == std::make_pair(uintptr_t(500), uint32_t(500)));
+	assert(plain_log[1] == std::make_pair(uintptr_t(windows + 20), uint32_t(windows + 20)));
+
+	// all gone
+	for(uint32_t id = 1; id <= windows + 20; ++id)
+		router.unroute(id);
+	for(uint32_t id = 0; id <= windows + 20; ++id)
+		assert(!router.routed(id));
+	fallback.seen.clear();
+	assert(router.dispatch(events) == 0);
+	assert(fallback.seen.size() == events.size());
+
+	// no fallback, nothing happens
+	router.fallback(nullptr);
+	assert(!router.dispatch(key(1, 0)));
+	assert(fallback.seen.size() == events.size());
+
+	std::printf("%zu events routed to %u windows\n", events.size() - to_fallback, windows);
+	return 0;
+}
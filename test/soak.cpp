@@ -0,0 +1,173 @@
+#include <cassert>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "simple/interactive/initializer.h"
+#include "simple/interactive/event.h"
+#include "simple/interactive/queue.h"
+#include "simple/interactive/motion.h"
+#include "simple/interactive/mouse_state.h"
+
+// A short version of the input soak example: mouse, touch and keys pushed from another thread,
+// drained on this one the usual way, with spilling on. Everything pushed is either received, in order, or counted as dropped,
+// and the state built from what was received adds up.
+
+using namespace simple::interactive;
+using namespace std::chrono_literals;
+
+constexpr uint32_t mouse_device = 0;
+constexpr uint32_t count = 200000;
+
+struct producer_stats
+{
+	std::atomic<std::size_t> pushed{0};
+	std::atomic<std::size_t> failed{0};
+	std::atomic<bool> done{false};
+};
+
+void produce(producer_stats& stats)
+{
+	std::minstd_rand random(0);
+	bool finger_down = false;
+	bool key_down = false;
+	// numbered in a field nothing downstream keys on, SDL stamps its own time
+	for(uint32_t number = 0; number < count; ++number)
+	{
+		SDL_Event event{};
+		const auto kind = random() % 11;
+		if(kind < 8)
+		{
+			event.type = SDL_MOUSEMOTION;
+			event.motion.which = mouse_device;
+			event.motion.windowID = number;
+			event.motion.xrel = int(random() % 7) - 3;
+			event.motion.yrel = int(random() % 7) - 3;
+			event.motion.x = int(number % 640);
+			event.motion.y = int(number % 480);
+		}
+		else if(kind < 10)
+		{
+			event.type = finger_down
+				? (random() % 16 == 0 ? SDL_FINGERUP : SDL_FINGERMOTION)
+				: SDL_FINGERDOWN;
+			finger_down = event.type != SDL_FINGERUP;
+			event.tfinger.touchId = 1;
+			event.tfinger.fingerId = 0;
+			// exact up to 2^24
+			event.tfinger.pressure = float(number);
+		}
+		else
+		{
+			event.type = key_down ? SDL_KEYUP : SDL_KEYDOWN;
+			event.key.state = key_down ? SDL_RELEASED : SDL_PRESSED;
+			event.key.keysym.scancode = SDL_SCANCODE_A;
+			event.key.keysym.sym = SDL_GetKeyFromScancode(SDL_SCANCODE_A);
+			event.key.windowID = number;
+			key_down = !key_down;
+		}
+
+		if(SDL_PushEvent(&event) == 1)
+			++stats.pushed;
+		else
+			++stats.failed;
+
+		if(number % 1000 == 0)
+			std::this_thread::sleep_for(100us);
+	}
+	stats.done = true;
+}
+
+// the number, for the events pushed above
+std::optional<uint32_t> number(const event& e)
+{
+	if(auto motion = std::get_if<mouse_motion>(&e))
+		return motion->data.window_id;
+	if(auto key = std::get_if<key_pressed>(&e))
+		return key->data.window_id;
+	if(auto key = std::get_if<key_released>(&e))
+		return key->data.window_id;
+	if(auto pointer = std::get_if<pointer_down>(&e))
+		return uint32_t(pointer->data.pressure);
+	if(auto pointer = std::get_if<pointer_motion>(&e))
+		return uint32_t(pointer->data.pressure);
+	if(auto pointer = std::get_if<pointer_up>(&e))
+		return uint32_t(pointer->data.pressure);
+	return std::nullopt;
+}
+
+int main()
+{
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", false);
+
+	initializer init;
+	track_queue_pressure(true);
+	spill_mode(256);
+
+	// whatever came up at start up
+	std::vector<event> events;
+	drain_events(events);
+	reset_queue_stats();
+
+	producer_stats stats;
+	std::thread producer(produce, std::ref(stats));
+
+	mouse_state_table mice;
+	motion_accumulator motion;
+	std::size_t received = 0;
+	std::optional<uint32_t> last;
+	int2 last_position{}, total_motion{};
+	while(true)
+	{
+		const bool finished = stats.done;
+		events.clear();
+		grow_spill();
+		pump();
+		const std::size_t drained = drain_events(events, no_pump);
+
+		for(auto& e : events)
+		{
+			const auto current = number(e);
+			if(!current)
+				continue;
+			assert(!last || *current > *last);
+			last = current;
+			++received;
+			if(auto m = std::get_if<mouse_motion>(&e))
+			{
+				last_position = m->data.position;
+				total_motion += m->data.motion;
+			}
+		}
+
+		mice.update(events);
+		motion.feed(events);
+
+		if(finished && drained == 0)
+			break;
+		std::this_thread::sleep_for(1ms);
+	}
+	producer.join();
+
+	check_queue_pressure(no_pump);
+	const auto pressure = queue_pressure();
+	assert(stats.pushed + stats.failed == count);
+	assert(received + pressure.dropped == stats.pushed);
+	assert(pressure.spill_depth == 0);
+	assert(buffered_events() == 0);
+
+	if(received != 0)
+	{
+		assert(mice.find(mouse_device));
+		assert(mice.find(mouse_device)->position == last_position);
+	}
+	assert(motion.take_whole(mouse_device) == total_motion);
+
+	std::printf("%zu pushed, %zu failed, %zu received, %zu dropped, %zu spills, %zu peak depth\n",
+		stats.pushed.load(), stats.failed.load(), received, pressure.dropped, pressure.spills, pressure.peak_depth);
+	return 0;
+}